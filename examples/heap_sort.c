@@ -38,14 +38,7 @@ int main(void)
         printf("%d ", arr[i]);
     printf("\n");
 
-    unds_heap_queue_t* hq = unds_heap_queue_create_from_array(arr, NUM_ARR, sizeof(int), comp);
-
-    int index = 0;
-    while (hq->size > 0)
-    {
-        unds_heap_queue_front(hq, &arr[index++]);
-        unds_heap_queue_pop(hq);
-    }
+    unds_heap_sort(arr, NUM_ARR, sizeof(int), comp);
 
     printf("Sorted Array:\n");
     for (int i = 0; i < NUM_ARR; i++)
@@ -54,8 +47,6 @@ int main(void)
 
     printf("%s.\n", is_sorted(arr, NUM_ARR) ? "Sorted" : "Unsorted");
 
-    unds_heap_queue_delete(hq);
-
     printf("\nCurrent Memory Usage (should be 0): %zu.\n", unds_used_malloc);
 
     return 0;
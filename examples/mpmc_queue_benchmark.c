@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define UNDS_TRACK_MEM
+#ifndef UNDS_USE_THREADS
+#define UNDS_USE_THREADS
+#endif
+#define UNDS_IMPLEMENTATION
+#define UNDS_MEMORY_IMPLEMENTATION
+#include "../unds.h"
+
+/*
+ * 사용법: mpmc_queue_benchmark [생산자당 메시지의 개수] [최대 스레드 개수] [큐의 용량]
+ * (컴파일 시 -pthread 필요)
+ *
+ * 생산자와 소비자의 수를 각각 1부터 최대 스레드 개수까지 두 배씩 늘려가며
+ * 처리량과 삽입부터 삭제까지 걸린 시간(지연 시간)을 측정한다.
+ */
+
+struct message_t
+{
+    uint64_t sent;
+};
+
+struct worker_t
+{
+    unds_mpmc_queue_t* queue;
+    size_t count;
+    uint64_t latency_sum;
+    uint64_t latency_max;
+};
+
+uint64_t now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+void* produce(void* arg)
+{
+    struct worker_t* worker = (struct worker_t*)arg;
+
+    for (size_t i = 0; i < worker->count; i++)
+    {
+        struct message_t message = {now()};
+        unds_mpmc_queue_push(worker->queue, &message);
+    }
+
+    return NULL;
+}
+
+void* consume(void* arg)
+{
+    struct worker_t* worker = (struct worker_t*)arg;
+
+    for (size_t i = 0; i < worker->count; i++)
+    {
+        struct message_t message;
+        unds_mpmc_queue_pop(worker->queue, &message);
+
+        uint64_t latency = now() - message.sent;
+        worker->latency_sum += latency;
+        if (latency > worker->latency_max)
+            worker->latency_max = latency;
+    }
+
+    return NULL;
+}
+
+void run(size_t num_producers, size_t num_consumers, size_t num_messages, size_t capacity)
+{
+    unds_mpmc_queue_t* queue = unds_mpmc_queue_create(sizeof(struct message_t), capacity);
+    struct worker_t* producers = (struct worker_t*)calloc(num_producers, sizeof(struct worker_t));
+    struct worker_t* consumers = (struct worker_t*)calloc(num_consumers, sizeof(struct worker_t));
+    pthread_t* threads = (pthread_t*)malloc((num_producers + num_consumers) * sizeof(pthread_t));
+
+    // 전체 메시지를 소비자들에게 고르게 나누어 각 소비자가 받을 개수를 미리 정한다.
+    size_t total = num_producers * num_messages;
+    for (size_t i = 0; i < num_consumers; i++)
+    {
+        consumers[i].queue = queue;
+        consumers[i].count = total / num_consumers + (i < total % num_consumers);
+    }
+    for (size_t i = 0; i < num_producers; i++)
+    {
+        producers[i].queue = queue;
+        producers[i].count = num_messages;
+    }
+
+    uint64_t begin = now();
+    for (size_t i = 0; i < num_consumers; i++)
+        pthread_create(&threads[i], NULL, consume, &consumers[i]);
+    for (size_t i = 0; i < num_producers; i++)
+        pthread_create(&threads[num_consumers + i], NULL, produce, &producers[i]);
+    for (size_t i = 0; i < num_producers + num_consumers; i++)
+        pthread_join(threads[i], NULL);
+    uint64_t end = now();
+
+    uint64_t latency_sum = 0;
+    uint64_t latency_max = 0;
+    for (size_t i = 0; i < num_consumers; i++)
+    {
+        latency_sum += consumers[i].latency_sum;
+        if (consumers[i].latency_max > latency_max)
+            latency_max = consumers[i].latency_max;
+    }
+
+    double seconds = (double)(end - begin) / 1e9;
+    printf("producers: %2zu, consumers: %2zu, throughput: %8.3f M msgs/s, latency avg: %9.3fus, max: %10.3fus, "
+           "empty: %s\n",
+           num_producers, num_consumers, (double)total / seconds / 1e6, (double)latency_sum / (double)total / 1e3,
+           (double)latency_max / 1e3, unds_mpmc_queue_empty(queue) ? "yes" : "no");
+
+    free(threads);
+    free(consumers);
+    free(producers);
+    unds_mpmc_queue_delete(queue);
+}
+
+int main(int argc, char** argv)
+{
+    size_t num_messages = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    size_t max_threads = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+    size_t capacity = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : 1024;
+
+    for (size_t num_producers = 1; num_producers <= max_threads; num_producers *= 2)
+        for (size_t num_consumers = 1; num_consumers <= max_threads; num_consumers *= 2)
+            run(num_producers, num_consumers, num_messages, capacity);
+
+    printf("Current Memory Usage (should be 0): %zu\n", unds_used_malloc);
+    return 0;
+}
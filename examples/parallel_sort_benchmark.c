@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define UNDS_TRACK_MEM
+#ifndef UNDS_USE_THREADS
+#define UNDS_USE_THREADS
+#endif
+#define UNDS_IMPLEMENTATION
+#define UNDS_MEMORY_IMPLEMENTATION
+#include "../unds.h"
+
+/*
+ * 사용법: parallel_sort_benchmark [요소의 개수] [최대 스레드 개수]
+ * (컴파일 시 -pthread 필요)
+ */
+
+int comp(const void* p, const void* q)
+{
+    int i = *(int*)p;
+    int j = *(int*)q;
+
+    return (i > j) - (i < j);
+}
+
+int is_sorted(int* arr, size_t size)
+{
+    for (size_t i = 0; i + 1 < size; i++)
+        if (comp(&arr[i], &arr[i + 1]) == 1)
+            return 0;
+    return 1;
+}
+
+double elapsed(struct timespec* begin, struct timespec* end)
+{
+    return (double)(end->tv_sec - begin->tv_sec) + (double)(end->tv_nsec - begin->tv_nsec) / 1e9;
+}
+
+int main(int argc, char** argv)
+{
+    size_t num_arr = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    size_t max_threads = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+
+    int* arr = (int*)malloc(num_arr * sizeof(int));
+    srand((unsigned int)time(NULL));
+    for (size_t i = 0; i < num_arr; i++)
+        arr[i] = rand();
+
+    double base = 0.0;
+    for (size_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        unds_list_t* list = unds_list_create_from_array(arr, num_arr, sizeof(int));
+
+        struct timespec begin, end;
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+        unds_list_parallel_sort(list, comp, num_threads);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double seconds = elapsed(&begin, &end);
+        if (num_threads == 1)
+            base = seconds;
+
+        printf("threads: %2zu, time: %.3fs, speedup: %.2fx, sorted: %s\n", num_threads, seconds, base / seconds,
+               is_sorted((int*)list->arr, list->size) ? "yes" : "no");
+
+        unds_list_delete(list);
+    }
+
+    free(arr);
+
+    printf("Current Memory Usage (should be 0): %zu\n", unds_used_malloc);
+    return 0;
+}
@@ -1,11 +1,13 @@
 #ifndef __UNDS_H
 #define __UNDS_H
 
+#include <stddef.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
-#ifdef UNDS_TRACK_MEM
+#if defined(UNDS_TRACK_MEM) || defined(UNDS_TRACE_MEM)
 #include "unds_memory.h"
 #else
 #include <stdlib.h>
@@ -15,6 +17,75 @@
 #define unds_free free
 #endif
 
+/**
+ * UNDS_USE_MMAP을 정의하면 UNDS_MMAP_THRESHOLD 이상의 컨테이너 저장 공간을 mmap으로 할당한다.
+ * mremap을 사용할 수 있다면(_GNU_SOURCE) 용량을 늘릴 때 데이터를 복사하지 않는다.
+ *
+ * UNDS_MMAP_HUGETLB를 함께 정의하면 MAP_HUGETLB로 휴지 페이지를 먼저 요청한다.
+ * 그렇지 않으면 madvise(MADV_HUGEPAGE)로 투명 휴지 페이지를 요청한다.
+ *
+ * 익명 매핑(MAP_ANONYMOUS 또는 MAP_ANON)은 _DEFAULT_SOURCE 등의 기능 검사 매크로가 있어야 선언되므로,
+ * 없으면(-std=c11 등) 모든 저장 공간을 힙에 할당한다.
+ */
+#ifdef UNDS_USE_MMAP
+#include <sys/mman.h>
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#ifndef UNDS_MMAP_THRESHOLD
+#define UNDS_MMAP_THRESHOLD ((size_t)32 << 20)
+#endif
+#ifndef UNDS_MMAP_HUGE_PAGE_SIZE
+#define UNDS_MMAP_HUGE_PAGE_SIZE ((size_t)2 << 20)
+#endif
+#endif
+
+/**
+ * UNDS_USE_THREADS를 정의하면 pthread를 이용하는 병렬 알고리즘과 동시성 큐를 사용할 수 있다.
+ * (컴파일 시 -pthread 필요)
+ *
+ * 리눅스에서는 블로킹 함수가 futex로 대기하며,
+ * 그 밖의 환경에서는 전역 뮤텍스와 조건 변수로 대기한다.
+ * _DEFAULT_SOURCE가 정의되어 있으면 제한 시간이 있는 대기는 CLOCK_MONOTONIC을 기준으로 하며,
+ * 그렇지 않으면 시스템 시각(TIME_UTC)을 기준으로 한다.
+ */
+#ifdef UNDS_USE_THREADS
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#ifndef UNDS_CACHE_LINE_SIZE
+/**
+ * 동시성 자료구조에서 거짓 공유를 피하기 위해 떨어뜨려 놓을 간격(바이트)
+ */
+#define UNDS_CACHE_LINE_SIZE 64
+#endif
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#define __UNDS_USE_FUTEX
+#endif
+#if defined(_DEFAULT_SOURCE) && !defined(__APPLE__)
+#define __UNDS_USE_MONOTONIC_COND
+#endif
+#ifndef UNDS_PARALLEL_SORT_CUTOFF
+/**
+ * 병렬 정렬 대신 단일 스레드 정렬을 사용할 최대 요소의 개수
+ */
+#define UNDS_PARALLEL_SORT_CUTOFF ((size_t)1 << 16)
+#endif
+#endif
+
+/**
+ * x86에서는 선형 탐색 함수(unds_list_find 등)가 SSE2/AVX2를 사용한다.
+ * AVX2는 실행 중에 CPU를 확인하여 사용하므로 -mavx2 없이 컴파일해도 된다.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define __UNDS_SCAN_X86
+#include <immintrin.h>
+#endif
+
 /**
  * 서로 같거나 다른 자료형의 두 변수를 유지하는 페어
  */
@@ -93,6 +164,377 @@ void unds_pair_set_first(unds_pair_t* ths, void* value);
  */
 void unds_pair_set_second(unds_pair_t* ths, void* value);
 
+/**
+ * 패턴 방어 퀵 정렬(pdqsort)로 배열 정렬
+ *
+ * 작은 구간은 삽입 정렬로 처리하고, 분할이 계속 한쪽으로 치우치면 힙 정렬로 전환하므로
+ * 최악의 경우에도 O(n log n)이다. 이미 정렬된 구간은 거의 선형 시간에 처리된다.
+ * 안정 정렬은 아니다.
+ *
+ * @brief 배열 정렬
+ * @param arr 정렬할 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ */
+void unds_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*));
+
+/**
+ * 이미 정렬된 구간(run)을 찾아 병합하는 적응형 병합 정렬(timsort)로 배열 정렬
+ *
+ * 내림차순 구간은 뒤집어서 사용하고, 짧은 구간은 이진 삽입 정렬로 늘린 뒤 병합한다.
+ * 거의 정렬된 배열은 선형 시간에 가깝게 처리된다. 같은 요소의 순서가 유지된다.
+ *
+ * @brief 배열 안정 정렬
+ * @param arr 정렬할 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param buffer 작업 공간 ((size / 2 + 1) * of_size바이트 이상, NULL이면 내부에서 할당)
+ */
+void unds_stable_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), void* buffer);
+
+/**
+ * pdqsort와 같은 방식으로 분할하되 n번째 위치를 포함하는 쪽만 계속 분할하는 선택 알고리즘(introselect)
+ *
+ * 평균 O(size)이며, 분할이 계속 치우치면 남은 구간을 힙 정렬하므로 최악의 경우에도 O(size log size)이다.
+ * 호출 후 arr[n]에는 정렬했을 때 n번째에 올 요소가 오고,
+ * 그 앞에는 arr[n]보다 작거나 같은 요소가, 그 뒤에는 크거나 같은 요소가 온다.
+ *
+ * @brief 배열의 n번째 요소를 제자리에 놓음
+ * @param arr 대상 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param n 제자리에 놓을 요소의 인덱스 (size 이상이면 아무것도 하지 않는다.)
+ */
+void unds_nth_element(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), size_t n);
+
+/**
+ * unds_nth_element로 앞의 k개를 고른 뒤 그것만 정렬하므로 O(size + k log k)이다.
+ * 뒤의 요소들의 순서는 정해져 있지 않다.
+ *
+ * @brief 배열의 가장 앞선 k개의 요소만 정렬하여 앞에 놓음
+ * @param arr 대상 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param k 정렬할 요소의 개수 (size보다 크면 전체를 정렬한다.)
+ */
+void unds_partial_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), size_t k);
+
+/**
+ * 힙 성질을 복구할 때 더 앞선 자식을 따라 잎까지 구멍을 내린 뒤 원래 요소를 위로 올리는
+ * Floyd의 상향식 방법을 사용하므로, 단계마다 비교를 한 번만 한다.
+ * 호출 후 arr[0]은 unds_heap_queue_t와 같이 비교 함수상 가장 앞선 요소가 된다.
+ *
+ * @brief 배열을 제자리에서 O(size)로 힙으로 변환
+ * @param arr 대상 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param comp 요소 비교 함수 (qsort의 comp와 동일, 작은 요소가 앞선다.)
+ */
+void unds_heapify(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*));
+
+/**
+ * unds_heapify와 같은 상향식 방법을 사용하며, 추가 메모리 없이 O(size log size)로 정렬한다.
+ * 안정 정렬이 아니다.
+ *
+ * @brief 배열을 제자리에서 힙 정렬
+ * @param arr 대상 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ */
+void unds_heap_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*));
+
+#ifdef UNDS_USE_THREADS
+
+/**
+ * 배열을 스레드 개수만큼 나누어 각각 unds_sort로 정렬한 뒤,
+ * 병합할 구간을 merge path로 다시 나누어 모든 스레드가 병합에 참여하도록 한다.
+ *
+ * 요소가 UNDS_PARALLEL_SORT_CUTOFF개 미만이거나 스레드가 하나이면 unds_sort를 사용한다.
+ * 안정 정렬이 아니며, 배열 크기만큼의 작업 공간을 추가로 사용한다.
+ *
+ * @brief 배열을 여러 스레드로 정렬
+ * @param arr 정렬할 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param num_threads 사용할 스레드의 개수 (0이면 사용 가능한 코어의 개수)
+ */
+void unds_parallel_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), size_t num_threads);
+
+#endif
+
+/**
+ * *내부 상수
+ *
+ * 삽입 정렬로 처리할 구간의 최대 길이
+ */
+#define __UNDS_SORT_INSERTION_THRESHOLD 24
+/**
+ * *내부 상수
+ *
+ * 피벗을 9개 요소의 중앙값으로 고르기 시작하는 구간의 길이
+ */
+#define __UNDS_SORT_NINTHER_THRESHOLD 128
+/**
+ * *내부 상수
+ *
+ * 부분 삽입 정렬이 포기하기 전까지 옮길 수 있는 요소의 개수
+ */
+#define __UNDS_SORT_PARTIAL_INSERTION_LIMIT 8
+/**
+ * *내부 상수
+ *
+ * 안정 정렬에서 병합을 기다리는 구간 스택의 최대 크기
+ * (구간 길이가 피보나치 수열보다 빠르게 늘어나므로 64비트 size_t에서 충분하다.)
+ */
+#define __UNDS_STABLE_SORT_MAX_RUNS 96
+
+#if defined(__GNUC__) || defined(__clang__)
+#define __UNDS_UNUSED __attribute__((unused))
+#else
+#define __UNDS_UNUSED
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define __UNDS_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define __UNDS_PREFETCH(addr) ((void)(addr))
+#endif
+
+/**
+ * 자료형과 비교 식을 컴파일 시간에 고정한 unds_sort를 생성한다.
+ * 비교 함수를 포인터로 호출하지 않고 요소를 자료형 단위로 교환하므로 unds_sort보다 빠르다.
+ *
+ * less(a, b)는 type의 두 값을 받아 a가 b보다 앞에 와야 하면 참인 식이어야 한다.
+ *
+ * -> int 리스트를 오름차순으로 정렬하는 경우.
+ *    #define int_less(a, b) ((a) < (b))
+ *    UNDS_SORT_DEFINE(int_sort, int, int_less)
+ *
+ *    int_sort((int*)list->arr, list->size);
+ *
+ * @brief 정렬 함수 static void name(type* arr, size_t size) 정의
+ * @param name 생성할 함수의 이름
+ * @param type 정렬할 요소의 자료형
+ * @param less 요소의 순서를 정의하는 식
+ */
+#define UNDS_SORT_DEFINE(name, type, less)                                                              \
+    __UNDS_UNUSED static void name##__swap(type* p, type* q)                                            \
+    {                                                                                                   \
+        type temp = *p;                                                                                 \
+        *p = *q;                                                                                        \
+        *q = temp;                                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    __UNDS_UNUSED static void name##__sort3(type* a, type* b, type* c)                                  \
+    {                                                                                                   \
+        if (less(*b, *a))                                                                               \
+            name##__swap(a, b);                                                                         \
+        if (less(*c, *b))                                                                               \
+            name##__swap(b, c);                                                                         \
+        if (less(*b, *a))                                                                               \
+            name##__swap(a, b);                                                                         \
+    }                                                                                                   \
+                                                                                                        \
+    __UNDS_UNUSED static bool name##__insertion(type* begin, type* end, bool partial)                   \
+    {                                                                                                   \
+        size_t moved = 0;                                                                               \
+                                                                                                        \
+        if (begin == end)                                                                               \
+            return true;                                                                                \
+                                                                                                        \
+        for (type* cur = begin + 1; cur != end; cur++)                                                  \
+        {                                                                                               \
+            if (!less(*cur, *(cur - 1)))                                                                \
+                continue;                                                                               \
+                                                                                                        \
+            type temp = *cur;                                                                           \
+            type* sift = cur;                                                                           \
+            do                                                                                          \
+            {                                                                                           \
+                *sift = *(sift - 1);                                                                    \
+                sift--;                                                                                 \
+            } while (sift != begin && less(temp, *(sift - 1)));                                         \
+            *sift = temp;                                                                               \
+                                                                                                        \
+            moved += (size_t)(cur - sift);                                                              \
+            if (partial && moved > __UNDS_SORT_PARTIAL_INSERTION_LIMIT)                                 \
+                return false;                                                                           \
+        }                                                                                               \
+                                                                                                        \
+        return true;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    __UNDS_UNUSED static void name##__sift_down(type* base, size_t index, size_t size)                  \
+    {                                                                                                   \
+        size_t child;                                                                                   \
+                                                                                                        \
+        while ((child = 2 * index + 1) < size)                                                          \
+        {                                                                                               \
+            if (child + 1 < size && less(base[child], base[child + 1]))                                 \
+                child++;                                                                                \
+            if (!less(base[index], base[child]))                                                        \
+                break;                                                                                  \
+                                                                                                        \
+            name##__swap(&base[index], &base[child]);                                                   \
+            index = child;                                                                              \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    __UNDS_UNUSED static void name##__heap(type* begin, type* end)                                      \
+    {                                                                                                   \
+        size_t size = (size_t)(end - begin);                                                            \
+                                                                                                        \
+        for (size_t i = size / 2; i-- > 0;)                                                             \
+            name##__sift_down(begin, i, size);                                                          \
+        for (size_t i = size; i-- > 1;)                                                                 \
+        {                                                                                               \
+            name##__swap(begin, begin + i);                                                             \
+            name##__sift_down(begin, 0, i);                                                             \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    __UNDS_UNUSED static type* name##__partition_right(type* begin, type* end, bool* already)           \
+    {                                                                                                   \
+        type pivot = *begin;                                                                            \
+        type* first = begin;                                                                            \
+        type* last = end;                                                                               \
+                                                                                                        \
+        while (less(*++first, pivot))                                                                   \
+            ;                                                                                           \
+        if (first - 1 == begin)                                                                         \
+            while (first < last && !less(*--last, pivot))                                               \
+                ;                                                                                       \
+        else                                                                                            \
+            while (!less(*--last, pivot))                                                               \
+                ;                                                                                       \
+                                                                                                        \
+        *already = first >= last;                                                                       \
+                                                                                                        \
+        while (first < last)                                                                            \
+        {                                                                                               \
+            name##__swap(first, last);                                                                  \
+            while (less(*++first, pivot))                                                               \
+                ;                                                                                       \
+            while (!less(*--last, pivot))                                                               \
+                ;                                                                                       \
+        }                                                                                               \
+                                                                                                        \
+        type* pivot_pos = first - 1;                                                                    \
+        *begin = *pivot_pos;                                                                            \
+        *pivot_pos = pivot;                                                                             \
+                                                                                                        \
+        return pivot_pos;                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    __UNDS_UNUSED static type* name##__partition_left(type* begin, type* end)                           \
+    {                                                                                                   \
+        type pivot = *begin;                                                                            \
+        type* first = begin;                                                                            \
+        type* last = end;                                                                               \
+                                                                                                        \
+        while (less(pivot, *--last))                                                                    \
+            ;                                                                                           \
+        if (last + 1 == end)                                                                            \
+            while (first < last && !less(pivot, *++first))                                              \
+                ;                                                                                       \
+        else                                                                                            \
+            while (!less(pivot, *++first))                                                              \
+                ;                                                                                       \
+                                                                                                        \
+        while (first < last)                                                                            \
+        {                                                                                               \
+            name##__swap(first, last);                                                                  \
+            while (less(pivot, *--last))                                                                \
+                ;                                                                                       \
+            while (!less(pivot, *++first))                                                              \
+                ;                                                                                       \
+        }                                                                                               \
+                                                                                                        \
+        *begin = *last;                                                                                 \
+        *last = pivot;                                                                                  \
+                                                                                                        \
+        return last;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    __UNDS_UNUSED static void name##__loop(type* begin, type* end, int bad_allowed, bool leftmost)      \
+    {                                                                                                   \
+        while (true)                                                                                    \
+        {                                                                                               \
+            size_t size = (size_t)(end - begin);                                                        \
+            if (size < __UNDS_SORT_INSERTION_THRESHOLD)                                                 \
+            {                                                                                           \
+                name##__insertion(begin, end, false);                                                   \
+                return;                                                                                 \
+            }                                                                                           \
+                                                                                                        \
+            size_t s2 = size / 2;                                                                       \
+            if (size > __UNDS_SORT_NINTHER_THRESHOLD)                                                   \
+            {                                                                                           \
+                name##__sort3(begin, begin + s2, end - 1);                                              \
+                name##__sort3(begin + 1, begin + (s2 - 1), end - 2);                                    \
+                name##__sort3(begin + 2, begin + (s2 + 1), end - 3);                                    \
+                name##__sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1));                          \
+                name##__swap(begin, begin + s2);                                                        \
+            }                                                                                           \
+            else                                                                                        \
+                name##__sort3(begin + s2, begin, end - 1);                                              \
+                                                                                                        \
+            if (!leftmost && !less(*(begin - 1), *begin))                                               \
+            {                                                                                           \
+                begin = name##__partition_left(begin, end) + 1;                                         \
+                continue;                                                                               \
+            }                                                                                           \
+                                                                                                        \
+            bool already;                                                                               \
+            type* pivot_pos = name##__partition_right(begin, end, &already);                            \
+            size_t l_size = (size_t)(pivot_pos - begin);                                                \
+            size_t r_size = (size_t)(end - (pivot_pos + 1));                                            \
+                                                                                                        \
+            if (l_size < size / 8 || r_size < size / 8)                                                 \
+            {                                                                                           \
+                if (--bad_allowed == 0)                                                                 \
+                {                                                                                       \
+                    name##__heap(begin, end);                                                           \
+                    return;                                                                             \
+                }                                                                                       \
+                                                                                                        \
+                if (l_size >= __UNDS_SORT_INSERTION_THRESHOLD)                                          \
+                {                                                                                       \
+                    name##__swap(begin, begin + l_size / 4);                                            \
+                    name##__swap(pivot_pos - 1, pivot_pos - l_size / 4);                                \
+                }                                                                                       \
+                if (r_size >= __UNDS_SORT_INSERTION_THRESHOLD)                                          \
+                {                                                                                       \
+                    name##__swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));                          \
+                    name##__swap(end - 1, end - r_size / 4);                                            \
+                }                                                                                       \
+            }                                                                                           \
+            else if (already && name##__insertion(begin, pivot_pos, true)                               \
+                     && name##__insertion(pivot_pos + 1, end, true))                                    \
+                return;                                                                                 \
+                                                                                                        \
+            name##__loop(begin, pivot_pos, bad_allowed, leftmost);                                      \
+            begin = pivot_pos + 1;                                                                      \
+            leftmost = false;                                                                           \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    __UNDS_UNUSED static void name(type* arr, size_t size)                                              \
+    {                                                                                                   \
+        int bad_allowed = 0;                                                                            \
+                                                                                                        \
+        while ((size >> bad_allowed) > 1)                                                               \
+            bad_allowed++;                                                                              \
+                                                                                                        \
+        name##__loop(arr, arr + size, bad_allowed, true);                                               \
+    }
+
 /**
  * 배열을 기반으로 구현된 가변 길이 리스트
  */
@@ -114,6 +556,14 @@ struct unds_list_t
      * 리스트 단일 요소의 크기
      */
     size_t of_size;
+    /**
+     * 구조체와 함께 할당된 내장 공간 또는 init에 전달된 공간 (없으면 NULL)
+     */
+    void* inline_arr;
+    /**
+     * 내장 공간의 용량 (용량이 이보다 작아지지 않으며, 이하일 때는 힙을 사용하지 않는다.)
+     */
+    size_t inline_capacity;
 };
 
 typedef struct unds_list_t unds_list_t;
@@ -143,6 +593,44 @@ unds_list_t* unds_list_create_from_array(void* arr, size_t size, size_t of_size)
  */
 unds_list_t* unds_list_create_from_value(void* value, size_t size, size_t of_size);
 
+/**
+ * 구조체 뒤에 capacity개의 요소를 담을 내장 공간을 붙여 한 번에 할당한다.
+ * 요소가 내장 공간에 들어가는 동안에는 힙을 더 사용하지 않으며, 넘치면 힙으로 옮긴다.
+ * 내장 공간의 용량은 2의 제곱수로 내림한다.
+ *
+ * @brief 내장 공간을 가진 새로운 리스트 생성
+ * @param of_size 리스트에 저장할 단일 요소의 크기
+ * @param capacity 내장 공간에 저장할 요소의 개수
+ * @return 동적으로 생성된 리스트의 주소
+ */
+unds_list_t* unds_list_create_inline(size_t of_size, size_t capacity);
+
+/**
+ * ths와 storage는 호출한 쪽이 소유하므로, 지역 변수로 선언하면
+ * 요소가 storage에 들어가는 동안 힙을 전혀 사용하지 않는다.
+ * unds_list_delete 대신 unds_list_deinit으로 정리해야 한다.
+ *
+ * -> int 요소 16개까지는 힙을 사용하지 않는 리스트.
+ *    int storage[16];
+ *    unds_list_t list;
+ *    unds_list_init(&list, sizeof(int), storage, 16);
+ *    ...
+ *    unds_list_deinit(&list);
+ *
+ * @brief 호출한 쪽의 공간을 내장 공간으로 사용하여 리스트 초기화
+ * @param ths 초기화할 리스트 포인터
+ * @param of_size 리스트에 저장할 단일 요소의 크기
+ * @param storage 내장 공간으로 사용할 공간의 포인터 (NULL이면 힙만 사용)
+ * @param capacity storage에 저장할 수 있는 요소의 개수 (2의 제곱수로 내림)
+ */
+void unds_list_init(unds_list_t* ths, size_t of_size, void* storage, size_t capacity);
+
+/**
+ * @brief unds_list_init으로 초기화한 리스트가 사용한 힙 공간 해제
+ * @param ths 대상 리스트 포인터
+ */
+void unds_list_deinit(unds_list_t* ths);
+
 /**
  * @brief 리스트 삭제
  * @param ths 대상 리스트 포인터
@@ -236,2091 +724,9983 @@ void unds_list_set(unds_list_t* ths, size_t index, void* value);
 void unds_list_insert(unds_list_t* ths, size_t index, void* value);
 
 /**
- * @brief 리스트의 특정 위치의 요소 삭제
+ * 뒤쪽 요소는 한 번만 이동하므로 k개의 요소를 하나씩 삽입하는 것보다 빠르다.
+ *
+ * @brief 리스트의 특정 위치에 배열의 요소를 한 번에 추가
  * @param ths 대상 리스트 포인터
- * @param index 삭제할 요소의 인덱스
+ * @param index 새로운 요소를 추가할 위치
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 개수
  */
-void unds_list_remove(unds_list_t* ths, size_t index);
+void unds_list_insert_range(unds_list_t* ths, size_t index, void* arr, size_t n);
 
 /**
- * @brief 리스트 초기화
+ * @brief 리스트의 특정 위치의 요소 삭제
  * @param ths 대상 리스트 포인터
+ * @param index 삭제할 요소의 인덱스
  */
-void unds_list_clear(unds_list_t* ths);
+void unds_list_remove(unds_list_t* ths, size_t index);
 
 /**
- * @brief 리스트 정렬
+ * 마지막 요소를 삭제할 위치로 옮기므로 요소의 순서가 유지되지 않는다.
+ *
+ * @brief 리스트의 특정 위치의 요소를 O(1)로 삭제
  * @param ths 대상 리스트 포인터
- * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
- */
-void unds_list_sort(unds_list_t* ths, int (*comp)(const void*, const void*));
-
-/**
- * 배열을 기반으로 구현된 가변 크기 덱
+ * @param index 삭제할 요소의 인덱스
  */
-struct unds_deque_t
-{
-    /**
-     * 실제 데이터를 저장할 공간에 대한 포인터
-     */
-    void* arr;
-    /**
-     * 덱의 한계 용량
-     */
-    size_t capacity;
-    /**
-     * 덱의 크기
-     */
-    size_t size;
-    /**
-     * 덱 단일 요소의 크기
-     */
-    size_t of_size;
-    /**
-     * 덱의 앞부분을 나타내는 인덱스
-     */
-    size_t head;
-    /**
-     * 덱의 뒷부분을 나타내는 인덱스
-     */
-    size_t tail;
-};
-
-typedef struct unds_deque_t unds_deque_t;
+void unds_list_swap_remove(unds_list_t* ths, size_t index);
 
 /**
- * @brief 새로운 덱 생성
- * @param of_size 덱에 저장할 단일 요소의 크기
- * @return 동적으로 생성된 덱의 주소
+ * @brief 리스트의 [begin, end) 범위의 요소 삭제
+ * @param ths 대상 리스트 포인터
+ * @param begin 삭제할 범위의 시작 인덱스
+ * @param end 삭제할 범위의 끝 인덱스 (포함하지 않음)
  */
-unds_deque_t* unds_deque_create(size_t of_size);
+void unds_list_erase_range(unds_list_t* ths, size_t begin, size_t end);
 
 /**
- * @brief 배열로부터 새로운 덱 생성
- * @param arr 덱으로 생성할 배열의 포인터
- * @param size 덱으로 생성할 배열의 길이
- * @param of_size 덱으로 생성할 배열의 단일 요소의 크기
- * @return 동적으로 생성된 덱의 주소
+ * 남는 요소는 한 번의 순회로 앞으로 모으며 순서가 유지된다.
+ *
+ * @brief 리스트에서 조건을 만족하는 모든 요소 삭제
+ * @param ths 대상 리스트 포인터
+ * @param pred 삭제 여부를 결정하는 함수 (true이면 삭제)
+ * @param ctx pred에 함께 넘길 포인터
+ * @return 삭제된 요소의 개수
  */
-unds_deque_t* unds_deque_create_from_array(void* arr, size_t size, size_t of_size);
+size_t unds_list_erase_if(unds_list_t* ths, bool (*pred)(const void* elem, void* ctx), void* ctx);
 
 /**
- * @brief 기본값을 설정하여 새로운 덱 생성
- * @param value 덱의 기본값으로 설정할 값의 포인터
- * @param size 생성할 덱의 길이
- * @param of_size 덱의 기본값으로 설정할 값의 크기
- * @return 동적으로 생성된 덱의 주소
+ * @brief 리스트 초기화
+ * @param ths 대상 리스트 포인터
  */
-unds_deque_t* unds_deque_create_from_value(void* value, size_t size, size_t of_size);
+void unds_list_clear(unds_list_t* ths);
 
 /**
- * @brief 덱 삭제
- * @param ths 대상 덱 포인터
+ * 이미 충분한 용량을 가지고 있다면 아무 것도 하지 않는다.
+ * 용량은 capacity개의 요소를 재할당 없이 삽입할 수 있는 2의 제곱수로 맞춘다.
+ *
+ * @brief 리스트의 용량을 미리 확보
+ * @param ths 대상 리스트 포인터
+ * @param capacity 확보할 요소의 개수
  */
-void unds_deque_delete(unds_deque_t* ths);
+void unds_list_reserve(unds_list_t* ths, size_t capacity);
 
 /**
- * @brief 덱이 비었는지 여부 반환
- * @param ths 대상 덱 포인터
- * @return 덱 빔 여부
+ * @brief 리스트의 용량을 현재 크기에 맞게 감소
+ * @param ths 대상 리스트 포인터
  */
-bool unds_deque_empty(unds_deque_t* ths);
+void unds_list_shrink_to_fit(unds_list_t* ths);
 
 /**
- * @brief 덱에 앞부분에 새로운 요소 삽입
- * @param ths 대상 덱 포인터
- * @param value 삽입할 대상을 가리키는 포인터
+ * @brief 리스트의 끝에 배열의 요소를 한 번에 삽입
+ * @param ths 대상 리스트 포인터
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 개수
  */
-void unds_deque_push_front(unds_deque_t* ths, void* value);
+void unds_list_push_n(unds_list_t* ths, void* arr, size_t n);
 
 /**
- * @brief 덱에 뒷부분에 새로운 요소 삽입
- * @param ths 대상 덱 포인터
- * @param value 삽입할 대상을 가리키는 포인터
+ * dest에는 삭제되는 요소가 리스트에 있던 순서 그대로 복사된다.
+ * dest가 NULL이면 복사하지 않고 삭제만 한다.
+ *
+ * @brief 리스트의 마지막 n개의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 리스트 포인터
+ * @param dest 요소를 복사할 목적지
+ * @param n 삭제할 요소의 개수
  */
-void unds_deque_push_back(unds_deque_t* ths, void* value);
+void unds_list_pop_n(unds_list_t* ths, void* dest, size_t n);
 
 /**
- * @brief 덱의 마지막 요소를 삭제
- * @param ths 대상 덱 포인터
+ * @brief 리스트의 끝에 다른 리스트의 모든 요소를 삽입
+ * @param ths 대상 리스트 포인터
+ * @param other 삽입할 요소를 가진 리스트 포인터
  */
-void unds_deque_pop_front(unds_deque_t* ths);
+void unds_list_append(unds_list_t* ths, unds_list_t* other);
 
 /**
- * @brief 덱의 마지막 요소를 삭제
- * @param ths 대상 덱 포인터
+ * unds_sort를 이용하므로 안정 정렬이 아니다.
+ *
+ * @brief 리스트 정렬
+ * @param ths 대상 리스트 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
  */
-void unds_deque_pop_back(unds_deque_t* ths);
+void unds_list_sort(unds_list_t* ths, int (*comp)(const void*, const void*));
 
 /**
- * @brief 덱의 첫 요소를 dest에 복사
- * @param ths 대상 덱 포인터
- * @param dest 요소를 복사할 목적지
+ * unds_stable_sort를 이용하므로 같은 요소의 순서가 유지된다.
+ * 여러 키로 정렬할 때는 덜 중요한 키부터 차례로 정렬하면 된다.
+ *
+ * @brief 리스트 안정 정렬
+ * @param ths 대상 리스트 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param buffer 작업 공간 ((size / 2 + 1) * of_size바이트 이상, NULL이면 내부에서 할당)
  */
-void unds_deque_front(unds_deque_t* ths, void* dest);
+void unds_list_stable_sort(unds_list_t* ths, int (*comp)(const void*, const void*), void* buffer);
 
 /**
- * @brief 덱의 마지막 요소를 dest에 복사
- * @param ths 대상 덱 포인터
- * @param dest 요소를 복사할 목적지
+ * unds_nth_element를 이용한다.
+ *
+ * @brief 리스트의 n번째 요소를 정렬했을 때의 자리에 놓음
+ * @param ths 대상 리스트 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param n 제자리에 놓을 요소의 인덱스
  */
-void unds_deque_back(unds_deque_t* ths, void* dest);
+void unds_list_nth_element(unds_list_t* ths, int (*comp)(const void*, const void*), size_t n);
 
 /**
- * @brief 덱 초기화
- * @param ths 대상 덱 포인터
+ * unds_partial_sort를 이용한다.
+ *
+ * @brief 리스트의 가장 앞선 k개의 요소만 정렬하여 앞에 놓음
+ * @param ths 대상 리스트 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param k 정렬할 요소의 개수
  */
-void unds_deque_clear(unds_deque_t* ths);
+void unds_list_partial_sort(unds_list_t* ths, int (*comp)(const void*, const void*), size_t k);
 
 /**
- * 리스트와 페어를 기반으로 구현된 가변 크기 해시맵
+ * 기수 정렬에 사용할 키의 자료형
  */
-struct unds_hash_map_t
+enum unds_radix_key_t
 {
     /**
-     * 실제 데이터를 저장하기 위한 리스트
-     */
-    unds_list_t** arr;
-    /**
-     * 해시맵의 한계 용량
+     * uint32_t
      */
-    size_t capacity;
+    UNDS_RADIX_KEY_U32,
     /**
-     * 해시맵에 저장된 요소의 개수
+     * uint64_t
      */
-    size_t size;
+    UNDS_RADIX_KEY_U64,
     /**
-     * 해시맵 키의 크기
+     * int32_t
      */
-    size_t of_size_key;
+    UNDS_RADIX_KEY_I32,
     /**
-     * 해시맵 값의 크기
+     * int64_t
      */
-    size_t of_size_value;
-
+    UNDS_RADIX_KEY_I64,
     /**
-     * 키의 해싱에 사용되는 해시 함수
+     * float
      */
-    size_t (*hash)(const void* p);
+    UNDS_RADIX_KEY_F32,
     /**
-     * 키의 비교에 사용되는 비교 함수
+     * double
      */
-    int (*comp)(const void* p, const void* q);
+    UNDS_RADIX_KEY_F64
 };
 
-typedef struct unds_hash_map_t unds_hash_map_t;
+typedef enum unds_radix_key_t unds_radix_key_t;
 
 /**
- * *참고: hash는 키의 해싱에 사용되는 함수로서, 해시맵의 크기에 적절한 충분히 큰 값을 반환해야 한다.
- *        comp는 qsort 등에서 사용되는 비교 함수와 마찬가지로 다음의 반환값을 가져야 한다.
- *        comp(p, q)에서:
- *            p >  q -> -1
- *            p == q ->  0
- *            p <  q ->  1
+ * 각 요소의 key_offset 위치에 있는 정수 또는 실수 키를 기준으로 오름차순 정렬한다.
+ * 키를 8비트씩 나누어 낮은 자리부터 분배하는 안정 정렬(LSD)이며, 모든 요소의 값이 같은 자리는 건너뛴다.
  *
- * @brief 새로운 해시맵 생성
- * @param of_size_key 키로 사용할 자료형의 크기
- * @param of_size_value 값으로 사용할 자료형의 크기
- * @param hash 키의 해싱에 사용되는 해시 함수
- * @param comp 키의 비교에 사용되는 해시 함수
- * @return 동적으로 생성된 해시맵 포인터
+ * buffer는 ths->size * ths->of_size 이상의 크기를 가진 작업 공간이어야 한다.
+ * 같은 buffer를 여러 번의 정렬에 재사용할 수 있으며, NULL이면 내부에서 할당한다.
+ *
+ * -> uint32_t 리스트를 정렬하는 경우.
+ *    unds_list_radix_sort(list, 0, UNDS_RADIX_KEY_U32, NULL);
+ *
+ * -> 구조체 리스트를 timestamp 멤버로 정렬하는 경우.
+ *    unds_list_radix_sort(list, offsetof(event_t, timestamp), UNDS_RADIX_KEY_I64, buffer);
+ *
+ * @brief 리스트를 고정 길이 키로 기수 정렬
+ * @param ths 대상 리스트 포인터
+ * @param key_offset 요소 내에서 키의 위치
+ * @param key_type 키의 자료형
+ * @param buffer 작업 공간 (NULL 가능)
  */
-unds_hash_map_t* unds_hash_map_create(size_t of_size_key, size_t of_size_value, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q));
+void unds_list_radix_sort(unds_list_t* ths, size_t key_offset, unds_radix_key_t key_type, void* buffer);
+
+#ifdef UNDS_USE_THREADS
 
 /**
- * @brief 해시맵 삭제
- * @param ths 대상 해시맵 포인터
+ * @brief 리스트를 여러 스레드로 정렬 (unds_parallel_sort 참고)
+ * @param ths 대상 리스트 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param num_threads 사용할 스레드의 개수 (0이면 사용 가능한 코어의 개수)
  */
-void unds_hash_map_delete(unds_hash_map_t* ths);
+void unds_list_parallel_sort(unds_list_t* ths, int (*comp)(const void*, const void*), size_t num_threads);
+
+#endif
 
 /**
- * *참고: 로드 팩터는 해시맵의 한계 용량 대비 실제 요소의 대수의 비율이다.
- *        (K / N, K는 요소의 개수, N은 해시맵의 한계 용량)
- *
- *        본 해시맵은 로드 팩터가 0.7 초과이면 용량을 두 배로 늘린다.
- *        본 해시맵은 로드 팩터가 0.3 미만이면 용량을 반으로 줄인다.
- *        (단, 최소 용량은 21)
+ * 리스트는 comp 기준으로 정렬되어 있어야 한다.
+ * 비교 결과에 따라 분기하지 않으므로 분기 예측 실패가 없다.
  *
- * @brief 해시맵의 로드 팩터 반환
- * @param ths 해시맵의 로드 팩터
+ * @brief key보다 작지 않은 첫 요소의 위치 반환
+ * @param ths 대상 리스트 포인터
+ * @param key 찾을 값의 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @return 위치 (없으면 리스트의 길이)
  */
-float unds_hash_map_get_load_factor(unds_hash_map_t* ths);
+size_t unds_list_lower_bound(unds_list_t* ths, const void* key, int (*comp)(const void*, const void*));
 
 /**
- * 해시맵에 키에 대응하는 요소가 존재하지 않으면 새로 삽입한다.
- * 해시맵에 키에 대응하는 요소가 이미 존재하면 아무 것도 하지 않는다.
+ * 리스트는 comp 기준으로 정렬되어 있어야 한다.
  *
- * @brief 해시맵에 새로운 요소 삽입
- * @param ths 대상 해시맵 포인터
- * @param key 키로 사용할 변수의 포인터
- * @param value 값으로 사용할 변수의 포인터
+ * @brief key보다 큰 첫 요소의 위치 반환
+ * @param ths 대상 리스트 포인터
+ * @param key 찾을 값의 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @return 위치 (없으면 리스트의 길이)
  */
-void unds_hash_map_push(unds_hash_map_t* ths, void* key, void* value);
+size_t unds_list_upper_bound(unds_list_t* ths, const void* key, int (*comp)(const void*, const void*));
 
 /**
- * @brief 해시맵에서 키에 대응하는 요소를 삭제
- * @param ths 대상 해시맵 포인터
- * @param key 키로 사용할 변수의 포인터
+ * 리스트는 comp 기준으로 정렬되어 있어야 한다.
+ *
+ * @brief key와 같은 요소의 구간 [first, last) 계산
+ * @param ths 대상 리스트 포인터
+ * @param key 찾을 값의 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @param first 구간의 시작 위치를 저장할 변수의 포인터
+ * @param last 구간의 끝 위치를 저장할 변수의 포인터
+ * @return key와 같은 요소의 개수
  */
-void unds_hash_map_pop(unds_hash_map_t* ths, void* key);
+size_t unds_list_equal_range(unds_list_t* ths, const void* key, int (*comp)(const void*, const void*), size_t* first, size_t* last);
 
 /**
- * @brief 해시맵에서 키에 대응하는 값을 dest에 복사
- * @param ths 대상 해시맵 포인터
- * @param dest 값을 복사할 목적지
- * @param key 키로 사용할 변수의 포인터
+ * 리스트는 comp 기준으로 정렬되어 있어야 하며, 같은 요소들의 맨 뒤에 삽입된다.
+ *
+ * @brief 정렬 순서를 유지하며 요소 삽입
+ * @param ths 대상 리스트 포인터
+ * @param value 삽입할 값의 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @return 삽입된 위치
  */
-void unds_hash_map_get(unds_hash_map_t* ths, void* dest, void* key);
+size_t unds_list_sorted_insert(unds_list_t* ths, void* value, int (*comp)(const void*, const void*));
 
 /**
- * @brief 해시맵에서 키에 대응하는 요소의 값을 value로 설정
- * @param ths 대상 해시맵 포인터
- * @param key 키로 사용할 변수의 포인터
- * @param value 요소의 값으로 사용할 변수의 포인터
+ * 정렬된 리스트를 완전 이진 트리의 너비 우선 순서(Eytzinger 배치)로 재배치한다.
+ * k번째 요소의 자식은 2k + 1, 2k + 2번째에 놓이므로 탐색 경로가 캐시에 잘 맞고 미리 읽기 쉽다.
+ *
+ * 재배치 후에는 정렬된 리스트가 아니므로 읽기 전용으로 사용하고,
+ * unds_list_eytzinger_search로만 탐색해야 한다. (다시 정렬하면 원래 순서로 돌아간다.)
+ *
+ * @brief 정렬된 리스트를 Eytzinger 배치로 재배치
+ * @param ths 대상 리스트 포인터
  */
-void unds_hash_map_set(unds_hash_map_t* ths, void* key, void* value);
+void unds_list_eytzinger_layout(unds_list_t* ths);
 
 /**
- * @brief 해시맵에 키에 대응하는 요소가 있는지 검사
- * @param ths 대상 해시맵 포인터
- * @param 키로 사용할 변수의 포인터
- * @return 키에 대응하는 요소의 존재 유무
+ * @brief Eytzinger 배치된 리스트에서 key보다 작지 않은 첫 요소의 위치 반환
+ * @param ths 대상 리스트 포인터 (unds_list_eytzinger_layout으로 재배치된 리스트)
+ * @param key 찾을 값의 포인터
+ * @param comp 정렬 기준을 정의하는 함수 (qsort의 comp와 동일)
+ * @return 재배치된 리스트에서의 위치 (없으면 리스트의 길이)
  */
-bool unds_hash_map_has(unds_hash_map_t* ths, void* key);
+size_t unds_list_eytzinger_search(unds_list_t* ths, const void* key, int (*comp)(const void*, const void*));
 
 /**
- * @brief 해시맵 초기화
- * @param ths 대상 해시맵 포인터
+ * 선형 탐색 함수(min, max, sum)에서 요소를 해석할 자료형
  */
-void unds_hash_map_clear(unds_hash_map_t* ths);
-
-struct unds_hash_set_t
+enum unds_scan_type_t
 {
-    /**
-     * 실제 데이터를 저장할 해시맵
-     */
-    unds_hash_map_t* map;
-    /**
-     * 해시셋의 한계 용량
-     */
-    size_t capacity;
-    /**
-     * 해시셋에 저장된 요소의 개수
-     */
-    size_t size;
-    /**
-     * 해시셋 키의 크기
-     */
-    size_t of_size;
-
-    /**
-     * 요소의 해싱에 사용되는 해시 함수
-     */
-    size_t (*hash)(const void* p);
-    /**
-     * 요소의 비교에 사용되는 비교 함수
-     */
-    int (*comp)(const void* p, const void* q);
+    UNDS_SCAN_I8,
+    UNDS_SCAN_U8,
+    UNDS_SCAN_I16,
+    UNDS_SCAN_U16,
+    UNDS_SCAN_I32,
+    UNDS_SCAN_U32,
+    UNDS_SCAN_I64,
+    UNDS_SCAN_U64,
+    UNDS_SCAN_F32,
+    UNDS_SCAN_F64
 };
 
-typedef struct unds_hash_set_t unds_hash_set_t;
+typedef enum unds_scan_type_t unds_scan_type_t;
 
 /**
- * *참고: hash는 키의 해싱에 사용되는 함수로서, 해시셋의 크기에 적절한 충분히 큰 값을 반환해야 한다.
- *        comp는 qsort 등에서 사용되는 비교 함수와 마찬가지로 다음의 반환값을 가져야 한다.
- *        comp(p, q)에서:
- *            p >  q -> -1
- *            p == q ->  0
- *            p <  q ->  1
+ * 요소를 바이트 단위로 비교하므로 모든 자료형에 사용할 수 있다.
+ * 요소의 크기가 1, 2, 4, 8바이트이면 SIMD로 비교한다. (실수의 0.0과 -0.0은 다른 값으로 취급한다.)
  *
- * @brief 새로운 해시셋 생성
- * @param of_size 요소 자료형의 크기
- * @param hash 요소의 해싱에 사용되는 해시 함수
- * @param comp 요소의 비교에 사용되는 해시 함수
- * @return 동적으로 생성된 해시셋의 포인터
+ * @brief value와 같은 첫 요소의 위치 반환
+ * @param ths 대상 리스트 포인터
+ * @param value 찾을 값의 포인터
+ * @return 위치 (없으면 리스트의 길이)
  */
-unds_hash_set_t* unds_hash_set_create(size_t of_size, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q));
+size_t unds_list_find(unds_list_t* ths, const void* value);
 
 /**
- * @brief 해시셋 삭제
- * @param ths 대상 해시셋 포인터
+ * @brief value와 같은 요소의 개수 반환 (unds_list_find 참고)
+ * @param ths 대상 리스트 포인터
+ * @param value 찾을 값의 포인터
+ * @return 같은 요소의 개수
  */
-void unds_hash_set_delete(unds_hash_set_t* ths);
+size_t unds_list_count(unds_list_t* ths, const void* value);
 
 /**
- * @brief 해시셋에 새로운 요소 추가
- * @param ths 대상 해시셋 포인터
- * @param elem 추가할 요소의 포인터
+ * @brief value와 같은 요소가 있는지 여부 반환 (unds_list_find 참고)
+ * @param ths 대상 리스트 포인터
+ * @param value 찾을 값의 포인터
+ * @return 같은 요소 존재 여부
  */
-void unds_hash_set_push(unds_hash_set_t* ths, void* elem);
+bool unds_list_contains(unds_list_t* ths, const void* value);
 
 /**
- * @brief 해시셋에서 요소 삭제
- * @param ths 대상 해시셋 포인터
- * @param elem 삭제할 요소의 포인터
+ * type의 크기는 리스트 단일 요소의 크기와 같아야 한다. (실수에 NaN이 있으면 결과는 정의되지 않는다.)
+ *
+ * @brief 최솟값 계산
+ * @param ths 대상 리스트 포인터
+ * @param type 요소의 자료형
+ * @param dest 최솟값을 저장할 변수의 포인터 (요소와 같은 자료형)
  */
-void unds_hash_set_pop(unds_hash_set_t* ths, void* elem);
+void unds_list_min(unds_list_t* ths, unds_scan_type_t type, void* dest);
 
 /**
- * @brief 요소의 존재 유무를 확인
- * @param ths 대상 해시셋 포인터
- * @param elem 존재 유무를 확인한 요소의 포인터
- * @return 해당 요소의 존재 유무
+ * type의 크기는 리스트 단일 요소의 크기와 같아야 한다. (실수에 NaN이 있으면 결과는 정의되지 않는다.)
+ *
+ * @brief 최댓값 계산
+ * @param ths 대상 리스트 포인터
+ * @param type 요소의 자료형
+ * @param dest 최댓값을 저장할 변수의 포인터 (요소와 같은 자료형)
  */
-bool unds_hash_set_has(unds_hash_set_t* ths, void* elem);
+void unds_list_max(unds_list_t* ths, unds_scan_type_t type, void* dest);
 
 /**
- * @brief 해시셋 초기화
- * @param ths 대상 해시셋 포인터
+ * 부호 있는 정수는 int64_t, 부호 없는 정수는 uint64_t, 실수는 double로 합을 구한다.
+ * type의 크기는 리스트 단일 요소의 크기와 같아야 한다.
+ *
+ * @brief 모든 요소의 합 계산
+ * @param ths 대상 리스트 포인터
+ * @param type 요소의 자료형
+ * @param dest 합을 저장할 변수의 포인터 (int64_t, uint64_t 또는 double)
  */
-void unds_hash_set_clear(unds_hash_set_t* ths);
+void unds_list_sum(unds_list_t* ths, unds_scan_type_t type, void* dest);
 
 /**
- * 배열을 기반으로 구현된 가변 크기 힙큐
+ * 배열을 기반으로 구현된 가변 크기 덱
  */
-struct unds_heap_queue_t
+struct unds_deque_t
 {
     /**
      * 실제 데이터를 저장할 공간에 대한 포인터
      */
     void* arr;
     /**
-     * 힙큐의 한계 용량
+     * 덱의 한계 용량
      */
     size_t capacity;
     /**
-     * 힙큐의 크기
+     * 덱의 크기
      */
     size_t size;
     /**
-     * 힙큐 단일 요소의 크기
+     * 덱 단일 요소의 크기
      */
     size_t of_size;
-
     /**
-     * 힙큐 연산 시에 사용되는 요소 비교 함수
+     * 덱의 앞부분을 나타내는 카운터 (실제 위치는 head & (capacity - 1))
      */
-    int (*comp)(const void* p, const void* q);
+    size_t head;
+    /**
+     * 덱의 뒷부분을 나타내는 카운터 (실제 위치는 tail & (capacity - 1), tail - head == size)
+     */
+    size_t tail;
 };
 
-typedef struct unds_heap_queue_t unds_heap_queue_t;
+typedef struct unds_deque_t unds_deque_t;
 
 /**
- * @brief 새로운 힙큐 생성
- * @param of_size 힙큐에 저장할 단일 요소의 크기
- * @param comp 힙큐 연산 시에 사용되는 요소 비교 함수
- * @return 동적으로 생성된 힙큐의 주소
+ * @brief 새로운 덱 생성
+ * @param of_size 덱에 저장할 단일 요소의 크기
+ * @return 동적으로 생성된 덱의 주소
  */
-unds_heap_queue_t* unds_heap_queue_create(size_t of_size, int (*comp)(const void* p, const void* q));
+unds_deque_t* unds_deque_create(size_t of_size);
 
 /**
- * @brief 배열로부터 새로운 힙큐 생성
- * @param arr 힙큐로 생성할 배열의 포인터
- * @param size 힙큐로 생성할 배열의 길이
- * @param of_size 힙큐로 생성할 배열의 단일 요소의 크기
- * @return 동적으로 생성된 힙큐의 주소
+ * @brief 배열로부터 새로운 덱 생성
+ * @param arr 덱으로 생성할 배열의 포인터
+ * @param size 덱으로 생성할 배열의 길이
+ * @param of_size 덱으로 생성할 배열의 단일 요소의 크기
+ * @return 동적으로 생성된 덱의 주소
  */
-unds_heap_queue_t* unds_heap_queue_create_from_array(void* arr, size_t size, size_t of_size, int (*comp)(const void* p, const void* q));
+unds_deque_t* unds_deque_create_from_array(void* arr, size_t size, size_t of_size);
 
 /**
- * @brief 기본값을 설정하여 새로운 힙큐 생성
- * @param value 힙큐의 기본값으로 설정할 값의 포인터
- * @param size 생성할 힙큐의 길이
- * @param of_size 힙큐의 기본값으로 설정할 값의 크기
- * @return 동적으로 생성된 힙큐의 주소
+ * @brief 기본값을 설정하여 새로운 덱 생성
+ * @param value 덱의 기본값으로 설정할 값의 포인터
+ * @param size 생성할 덱의 길이
+ * @param of_size 덱의 기본값으로 설정할 값의 크기
+ * @return 동적으로 생성된 덱의 주소
  */
-unds_heap_queue_t* unds_heap_queue_create_from_value(void* value, size_t size, size_t of_size, int (*comp)(const void* p, const void* q));
+unds_deque_t* unds_deque_create_from_value(void* value, size_t size, size_t of_size);
 
 /**
- * @brief 힙큐 삭제
- * @param ths 대상 힙큐 포인터
+ * @brief 덱 삭제
+ * @param ths 대상 덱 포인터
  */
-void unds_heap_queue_delete(unds_heap_queue_t* ths);
+void unds_deque_delete(unds_deque_t* ths);
 
 /**
- * @brief 힙큐가 비었는지 여부 반환
- * @param ths 대상 힙큐 포인터
- * @return 힙큐 빔 여부
+ * @brief 덱이 비었는지 여부 반환
+ * @param ths 대상 덱 포인터
+ * @return 덱 빔 여부
  */
-bool unds_heap_queue_empty(unds_heap_queue_t* ths);
+bool unds_deque_empty(unds_deque_t* ths);
 
 /**
- * @brief 힙큐에 새로운 요소 삽입
+ * @brief 덱에 앞부분에 새로운 요소 삽입
  * @param ths 대상 덱 포인터
  * @param value 삽입할 대상을 가리키는 포인터
  */
-void unds_heap_queue_push(unds_heap_queue_t* ths, void* value);
+void unds_deque_push_front(unds_deque_t* ths, void* value);
 
 /**
- * @brief 힙큐의 첫 요소를 삭제
- * @param ths 대상 힙큐 포인터
+ * @brief 덱에 뒷부분에 새로운 요소 삽입
+ * @param ths 대상 덱 포인터
+ * @param value 삽입할 대상을 가리키는 포인터
  */
-void unds_heap_queue_pop(unds_heap_queue_t* ths);
+void unds_deque_push_back(unds_deque_t* ths, void* value);
 
 /**
- * @brief 힙큐의 첫 요소를 dest에 복사
- * @param ths 대상 힙큐 포인터
+ * @brief 덱의 마지막 요소를 삭제
+ * @param ths 대상 덱 포인터
+ */
+void unds_deque_pop_front(unds_deque_t* ths);
+
+/**
+ * @brief 덱의 마지막 요소를 삭제
+ * @param ths 대상 덱 포인터
+ */
+void unds_deque_pop_back(unds_deque_t* ths);
+
+/**
+ * @brief 덱의 첫 요소를 dest에 복사
+ * @param ths 대상 덱 포인터
  * @param dest 요소를 복사할 목적지
  */
-void unds_heap_queue_front(unds_heap_queue_t* ths, void* dest);
+void unds_deque_front(unds_deque_t* ths, void* dest);
 
 /**
- * @brief 힙큐 초기화
- * @param ths 대상 힙큐 포인터
+ * @brief 덱의 마지막 요소를 dest에 복사
+ * @param ths 대상 덱 포인터
+ * @param dest 요소를 복사할 목적지
  */
-void unds_heap_queue_clear(unds_heap_queue_t* ths);
+void unds_deque_back(unds_deque_t* ths, void* dest);
 
 /**
- * 배열을 기반으로 구현된 가변 크기 큐
+ * @brief 덱 초기화
+ * @param ths 대상 덱 포인터
  */
-struct unds_queue_t
-{
-    /**
-     * 실제 데이터를 저장할 공간에 대한 포인터
-     */
-    void* arr;
+void unds_deque_clear(unds_deque_t* ths);
+
+/**
+ * 이미 충분한 용량을 가지고 있다면 아무 것도 하지 않는다.
+ * 용량은 capacity개의 요소를 재할당 없이 삽입할 수 있는 2의 제곱수로 맞춘다.
+ *
+ * @brief 덱의 용량을 미리 확보
+ * @param ths 대상 덱 포인터
+ * @param capacity 확보할 요소의 개수
+ */
+void unds_deque_reserve(unds_deque_t* ths, size_t capacity);
+
+/**
+ * @brief 덱의 용량을 현재 크기에 맞게 감소
+ * @param ths 대상 덱 포인터
+ */
+void unds_deque_shrink_to_fit(unds_deque_t* ths);
+
+/**
+ * 삽입 후 덱의 첫 요소는 arr[0]이 된다.
+ *
+ * @brief 덱의 앞부분에 배열의 요소를 한 번에 삽입
+ * @param ths 대상 덱 포인터
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 개수
+ */
+void unds_deque_push_front_n(unds_deque_t* ths, void* arr, size_t n);
+
+/**
+ * @brief 덱의 뒷부분에 배열의 요소를 한 번에 삽입
+ * @param ths 대상 덱 포인터
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 개수
+ */
+void unds_deque_push_back_n(unds_deque_t* ths, void* arr, size_t n);
+
+/**
+ * dest에는 삭제되는 요소가 덱에 있던 순서 그대로 복사된다.
+ * dest가 NULL이면 복사하지 않고 삭제만 한다.
+ *
+ * @brief 덱의 앞부분의 n개의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 덱 포인터
+ * @param dest 요소를 복사할 목적지
+ * @param n 삭제할 요소의 개수
+ */
+void unds_deque_pop_front_n(unds_deque_t* ths, void* dest, size_t n);
+
+/**
+ * dest에는 삭제되는 요소가 덱에 있던 순서 그대로 복사된다.
+ * dest가 NULL이면 복사하지 않고 삭제만 한다.
+ *
+ * @brief 덱의 뒷부분의 n개의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 덱 포인터
+ * @param dest 요소를 복사할 목적지
+ * @param n 삭제할 요소의 개수
+ */
+void unds_deque_pop_back_n(unds_deque_t* ths, void* dest, size_t n);
+
+#ifndef UNDS_SEGMENTED_DEQUE_CHUNK_BYTES
+/**
+ * 세그먼트 덱의 청크 하나의 목표 크기(바이트)
+ * (청크에 들어가는 요소의 개수는 이 크기 이하의 2의 제곱수이며, 최소 1개이다.)
+ */
+#define UNDS_SEGMENTED_DEQUE_CHUNK_BYTES 4096
+#endif
+
+/**
+ * *내부 상수
+ *
+ * 세그먼트 덱이 해제하지 않고 재사용을 위해 보관하는 빈 청크의 최대 개수
+ */
+#define __UNDS_SEGMENTED_DEQUE_SPARE 4
+
+/**
+ * 고정 크기 청크들과 청크 포인터의 원형 배열(맵)로 구현된 덱 (C++의 std::deque와 유사)
+ *
+ * 용량이 늘어나도 요소를 복사하지 않으므로 삽입과 삭제는 항상 O(1)이고,
+ * 요소의 주소는 그 요소가 삭제될 때까지 바뀌지 않는다.
+ * 비게 된 청크는 몇 개를 보관해 두었다가 새 청크가 필요할 때 재사용한다.
+ */
+struct unds_segmented_deque_t
+{
     /**
-     * 큐의 한계 용량
+     * 청크 포인터의 원형 배열
      */
-    size_t capacity;
+    void** map;
     /**
-     * 큐의 크기
+     * 맵의 용량 (2의 제곱수)
+     */
+    size_t map_capacity;
+    /**
+     * 첫 청크의 맵에서의 위치
+     */
+    size_t map_head;
+    /**
+     * 사용 중인 청크의 개수
+     */
+    size_t num_chunks;
+    /**
+     * 첫 요소의 첫 청크에서의 위치
+     */
+    size_t front;
+    /**
+     * 덱의 크기
      */
     size_t size;
     /**
-     * 큐 단일 요소의 크기
+     * 덱 단일 요소의 크기
      */
     size_t of_size;
     /**
-     * 큐의 앞부분을 나타내는 인덱스
+     * 청크 하나에 들어가는 요소의 개수 (2의 제곱수)
      */
-    size_t head;
+    size_t chunk_size;
     /**
-     * 큐의 뒷부분을 나타내는 인덱스
+     * log2(chunk_size)
      */
-    size_t tail;
+    size_t chunk_shift;
+    /**
+     * 재사용을 위해 보관 중인 빈 청크
+     */
+    void* spare[__UNDS_SEGMENTED_DEQUE_SPARE];
+    /**
+     * 보관 중인 빈 청크의 개수
+     */
+    size_t num_spare;
 };
 
-typedef struct unds_queue_t unds_queue_t;
+typedef struct unds_segmented_deque_t unds_segmented_deque_t;
 
 /**
- * @brief 새로운 큐 생성
- * @param of_size 큐에 저장할 단일 요소의 크기
- * @return 동적으로 생성된 큐의 주소
+ * @brief 새로운 세그먼트 덱 생성
+ * @param of_size 덱에 저장할 단일 요소의 크기
+ * @return 동적으로 생성된 덱의 주소
  */
-unds_queue_t* unds_queue_create(size_t of_size);
+unds_segmented_deque_t* unds_segmented_deque_create(size_t of_size);
 
 /**
- * @brief 배열로부터 새로운 큐 생성
- * @param arr 큐로 생성할 배열의 포인터
- * @param size 큐로 생성할 배열의 길이
- * @param of_size 큐로 생성할 배열의 단일 요소의 크기
- * @return 동적으로 생성된 큐의 주소
+ * @brief 배열로부터 새로운 세그먼트 덱 생성
+ * @param arr 덱으로 생성할 배열의 포인터
+ * @param size 덱으로 생성할 배열의 길이
+ * @param of_size 덱으로 생성할 배열의 단일 요소의 크기
+ * @return 동적으로 생성된 덱의 주소
  */
-unds_queue_t* unds_queue_create_from_array(void* arr, size_t size, size_t of_size);
+unds_segmented_deque_t* unds_segmented_deque_create_from_array(void* arr, size_t size, size_t of_size);
 
 /**
- * @brief 기본값을 설정하여 새로운 큐 생성
- * @param value 큐의 기본값으로 설정할 값의 포인터
- * @param size 생성할 큐의 길이
- * @param of_size 큐의 기본값으로 설정할 값의 크기
- * @return 동적으로 생성된 큐의 주소
+ * @brief 기본값을 설정하여 새로운 세그먼트 덱 생성
+ * @param value 덱의 기본값으로 설정할 값의 포인터
+ * @param size 생성할 덱의 길이
+ * @param of_size 덱의 기본값으로 설정할 값의 크기
+ * @return 동적으로 생성된 덱의 주소
  */
-unds_queue_t* unds_queue_create_from_value(void* value, size_t size, size_t of_size);
+unds_segmented_deque_t* unds_segmented_deque_create_from_value(void* value, size_t size, size_t of_size);
 
 /**
- * @brief 큐 삭제
- * @param ths 대상 큐 포인터
+ * @brief 세그먼트 덱 삭제
+ * @param ths 대상 덱 포인터
  */
-void unds_queue_delete(unds_queue_t* ths);
+void unds_segmented_deque_delete(unds_segmented_deque_t* ths);
 
 /**
- * @brief 큐이 비었는지 여부 반환
- * @param ths 대상 큐 포인터
- * @return 큐 빔 여부
+ * @brief 세그먼트 덱이 비었는지 여부 반환
+ * @param ths 대상 덱 포인터
+ * @return 덱 빔 여부
  */
-bool unds_queue_empty(unds_queue_t* ths);
+bool unds_segmented_deque_empty(unds_segmented_deque_t* ths);
 
 /**
- * @brief 큐에 새로운 요소 삽입
- * @param ths 대상 큐 포인터
- * @param value 삽입할 대상을 가리키는 포인터
+ * @brief 세그먼트 덱의 앞부분에 요소 삽입
+ * @param ths 대상 덱 포인터
+ * @param value 삽입할 값의 포인터
  */
-void unds_queue_push(unds_queue_t* ths, void* value);
+void unds_segmented_deque_push_front(unds_segmented_deque_t* ths, void* value);
 
 /**
- * @brief 큐의 첫 요소를 삭제
- * @param ths 대상 큐 포인터
+ * @brief 세그먼트 덱의 뒷부분에 요소 삽입
+ * @param ths 대상 덱 포인터
+ * @param value 삽입할 값의 포인터
  */
-void unds_queue_pop(unds_queue_t* ths);
+void unds_segmented_deque_push_back(unds_segmented_deque_t* ths, void* value);
 
 /**
- * @brief 큐의 첫 요소를 dest에 복사
- * @param ths 대상 큐 포인터
- * @param dest 요소를 복사할 목적지
+ * @brief 세그먼트 덱의 앞부분의 요소 삭제
+ * @param ths 대상 덱 포인터
  */
-void unds_queue_front(unds_queue_t* ths, void* dest);
+void unds_segmented_deque_pop_front(unds_segmented_deque_t* ths);
 
 /**
- * @brief 큐의 마지막 요소를 dest에 복사
- * @param ths 대상 큐 포인터
- * @param dest 요소를 복사할 목적지
+ * @brief 세그먼트 덱의 뒷부분의 요소 삭제
+ * @param ths 대상 덱 포인터
  */
-void unds_queue_back(unds_queue_t* ths, void* dest);
+void unds_segmented_deque_pop_back(unds_segmented_deque_t* ths);
 
 /**
- * @brief 큐 초기화
- * @param ths 대상 큐 포인터
+ * @brief 세그먼트 덱의 앞부분의 요소 읽기
+ * @param ths 대상 덱 포인터
+ * @param dest 읽은 값을 저장할 변수의 포인터
  */
-void unds_queue_clear(unds_queue_t* ths);
+void unds_segmented_deque_front(unds_segmented_deque_t* ths, void* dest);
 
 /**
- * 배열을 기반으로 구현된 가변 크기 스택
+ * @brief 세그먼트 덱의 뒷부분의 요소 읽기
+ * @param ths 대상 덱 포인터
+ * @param dest 읽은 값을 저장할 변수의 포인터
  */
-struct unds_stack_t
+void unds_segmented_deque_back(unds_segmented_deque_t* ths, void* dest);
+
+/**
+ * 반환된 주소는 해당 요소가 삭제되기 전까지 유효하다. (다른 요소의 삽입, 삭제와 무관)
+ *
+ * @brief 세그먼트 덱의 index번째 요소의 주소 반환
+ * @param ths 대상 덱 포인터
+ * @param index 요소의 위치
+ * @return 요소의 주소
+ */
+void* unds_segmented_deque_at(unds_segmented_deque_t* ths, size_t index);
+
+/**
+ * @brief 세그먼트 덱의 index번째 요소 읽기
+ * @param ths 대상 덱 포인터
+ * @param dest 읽은 값을 저장할 변수의 포인터
+ * @param index 읽을 요소의 위치
+ */
+void unds_segmented_deque_get(unds_segmented_deque_t* ths, void* dest, size_t index);
+
+/**
+ * @brief 세그먼트 덱의 index번째 요소 변경
+ * @param ths 대상 덱 포인터
+ * @param index 변경할 요소의 위치
+ * @param value 변경할 값의 포인터
+ */
+void unds_segmented_deque_set(unds_segmented_deque_t* ths, size_t index, void* value);
+
+/**
+ * @brief 세그먼트 덱 초기화
+ * @param ths 대상 덱 포인터
+ */
+void unds_segmented_deque_clear(unds_segmented_deque_t* ths);
+
+/**
+ * 보관 중인 빈 청크를 해제하고 맵을 사용 중인 청크에 맞게 줄인다.
+ *
+ * @brief 세그먼트 덱이 사용하는 공간을 현재 크기에 맞게 감소
+ * @param ths 대상 덱 포인터
+ */
+void unds_segmented_deque_shrink_to_fit(unds_segmented_deque_t* ths);
+
+/**
+ * @brief 세그먼트 덱의 뒷부분에 배열의 요소를 한 번에 삽입
+ * @param ths 대상 덱 포인터
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 개수
+ */
+void unds_segmented_deque_push_back_n(unds_segmented_deque_t* ths, void* arr, size_t n);
+
+/**
+ * dest에는 삭제되는 요소가 덱에 있던 순서 그대로 복사된다.
+ * dest가 NULL이면 복사하지 않고 삭제만 한다.
+ *
+ * @brief 세그먼트 덱의 앞부분의 n개의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 덱 포인터
+ * @param dest 요소를 복사할 목적지
+ * @param n 삭제할 요소의 개수
+ */
+void unds_segmented_deque_pop_front_n(unds_segmented_deque_t* ths, void* dest, size_t n);
+
+/**
+ * 리스트와 페어를 기반으로 구현된 가변 크기 해시맵
+ */
+struct unds_hash_map_t
 {
     /**
-     * 실제 데이터를 저장할 공간에 대한 포인터
+     * 실제 데이터를 저장하기 위한 리스트
      */
-    void* arr;
+    unds_list_t** arr;
     /**
-     * 스택의 한계 용량
+     * 해시맵의 한계 용량
      */
     size_t capacity;
     /**
-     * 스택의 크기
+     * 해시맵에 저장된 요소의 개수
      */
     size_t size;
     /**
-     * 스택 단일 요소의 크기
+     * 해시맵 키의 크기
      */
-    size_t of_size;
+    size_t of_size_key;
+    /**
+     * 해시맵 값의 크기
+     */
+    size_t of_size_value;
+
+    /**
+     * 키의 해싱에 사용되는 해시 함수
+     */
+    size_t (*hash)(const void* p);
+    /**
+     * 키의 비교에 사용되는 비교 함수
+     */
+    int (*comp)(const void* p, const void* q);
 };
 
-typedef struct unds_stack_t unds_stack_t;
+typedef struct unds_hash_map_t unds_hash_map_t;
+
+/**
+ * *참고: hash는 키의 해싱에 사용되는 함수로서, 해시맵의 크기에 적절한 충분히 큰 값을 반환해야 한다.
+ *        comp는 qsort 등에서 사용되는 비교 함수와 마찬가지로 다음의 반환값을 가져야 한다.
+ *        comp(p, q)에서:
+ *            p >  q -> -1
+ *            p == q ->  0
+ *            p <  q ->  1
+ *
+ * @brief 새로운 해시맵 생성
+ * @param of_size_key 키로 사용할 자료형의 크기
+ * @param of_size_value 값으로 사용할 자료형의 크기
+ * @param hash 키의 해싱에 사용되는 해시 함수
+ * @param comp 키의 비교에 사용되는 해시 함수
+ * @return 동적으로 생성된 해시맵 포인터
+ */
+unds_hash_map_t* unds_hash_map_create(size_t of_size_key, size_t of_size_value, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 해시맵 삭제
+ * @param ths 대상 해시맵 포인터
+ */
+void unds_hash_map_delete(unds_hash_map_t* ths);
+
+/**
+ * *참고: 로드 팩터는 해시맵의 한계 용량 대비 실제 요소의 대수의 비율이다.
+ *        (K / N, K는 요소의 개수, N은 해시맵의 한계 용량)
+ *
+ *        본 해시맵은 로드 팩터가 0.7 초과이면 용량을 두 배로 늘린다.
+ *        본 해시맵은 로드 팩터가 0.3 미만이면 용량을 반으로 줄인다.
+ *        (단, 최소 용량은 21)
+ *
+ * @brief 해시맵의 로드 팩터 반환
+ * @param ths 해시맵의 로드 팩터
+ */
+float unds_hash_map_get_load_factor(unds_hash_map_t* ths);
+
+/**
+ * 해시맵에 키에 대응하는 요소가 존재하지 않으면 새로 삽입한다.
+ * 해시맵에 키에 대응하는 요소가 이미 존재하면 아무 것도 하지 않는다.
+ *
+ * @brief 해시맵에 새로운 요소 삽입
+ * @param ths 대상 해시맵 포인터
+ * @param key 키로 사용할 변수의 포인터
+ * @param value 값으로 사용할 변수의 포인터
+ */
+void unds_hash_map_push(unds_hash_map_t* ths, void* key, void* value);
+
+/**
+ * @brief 해시맵에서 키에 대응하는 요소를 삭제
+ * @param ths 대상 해시맵 포인터
+ * @param key 키로 사용할 변수의 포인터
+ */
+void unds_hash_map_pop(unds_hash_map_t* ths, void* key);
+
+/**
+ * @brief 해시맵에서 키에 대응하는 값을 dest에 복사
+ * @param ths 대상 해시맵 포인터
+ * @param dest 값을 복사할 목적지
+ * @param key 키로 사용할 변수의 포인터
+ */
+void unds_hash_map_get(unds_hash_map_t* ths, void* dest, void* key);
+
+/**
+ * @brief 해시맵에서 키에 대응하는 요소의 값을 value로 설정
+ * @param ths 대상 해시맵 포인터
+ * @param key 키로 사용할 변수의 포인터
+ * @param value 요소의 값으로 사용할 변수의 포인터
+ */
+void unds_hash_map_set(unds_hash_map_t* ths, void* key, void* value);
+
+/**
+ * @brief 해시맵에 키에 대응하는 요소가 있는지 검사
+ * @param ths 대상 해시맵 포인터
+ * @param 키로 사용할 변수의 포인터
+ * @return 키에 대응하는 요소의 존재 유무
+ */
+bool unds_hash_map_has(unds_hash_map_t* ths, void* key);
+
+/**
+ * @brief 해시맵 초기화
+ * @param ths 대상 해시맵 포인터
+ */
+void unds_hash_map_clear(unds_hash_map_t* ths);
+
+struct unds_hash_set_t
+{
+    /**
+     * 실제 데이터를 저장할 해시맵
+     */
+    unds_hash_map_t* map;
+    /**
+     * 해시셋의 한계 용량
+     */
+    size_t capacity;
+    /**
+     * 해시셋에 저장된 요소의 개수
+     */
+    size_t size;
+    /**
+     * 해시셋 키의 크기
+     */
+    size_t of_size;
+
+    /**
+     * 요소의 해싱에 사용되는 해시 함수
+     */
+    size_t (*hash)(const void* p);
+    /**
+     * 요소의 비교에 사용되는 비교 함수
+     */
+    int (*comp)(const void* p, const void* q);
+};
+
+typedef struct unds_hash_set_t unds_hash_set_t;
+
+/**
+ * *참고: hash는 키의 해싱에 사용되는 함수로서, 해시셋의 크기에 적절한 충분히 큰 값을 반환해야 한다.
+ *        comp는 qsort 등에서 사용되는 비교 함수와 마찬가지로 다음의 반환값을 가져야 한다.
+ *        comp(p, q)에서:
+ *            p >  q -> -1
+ *            p == q ->  0
+ *            p <  q ->  1
+ *
+ * @brief 새로운 해시셋 생성
+ * @param of_size 요소 자료형의 크기
+ * @param hash 요소의 해싱에 사용되는 해시 함수
+ * @param comp 요소의 비교에 사용되는 해시 함수
+ * @return 동적으로 생성된 해시셋의 포인터
+ */
+unds_hash_set_t* unds_hash_set_create(size_t of_size, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 해시셋 삭제
+ * @param ths 대상 해시셋 포인터
+ */
+void unds_hash_set_delete(unds_hash_set_t* ths);
+
+/**
+ * @brief 해시셋에 새로운 요소 추가
+ * @param ths 대상 해시셋 포인터
+ * @param elem 추가할 요소의 포인터
+ */
+void unds_hash_set_push(unds_hash_set_t* ths, void* elem);
+
+/**
+ * @brief 해시셋에서 요소 삭제
+ * @param ths 대상 해시셋 포인터
+ * @param elem 삭제할 요소의 포인터
+ */
+void unds_hash_set_pop(unds_hash_set_t* ths, void* elem);
+
+/**
+ * @brief 요소의 존재 유무를 확인
+ * @param ths 대상 해시셋 포인터
+ * @param elem 존재 유무를 확인한 요소의 포인터
+ * @return 해당 요소의 존재 유무
+ */
+bool unds_hash_set_has(unds_hash_set_t* ths, void* elem);
+
+/**
+ * @brief 해시셋 초기화
+ * @param ths 대상 해시셋 포인터
+ */
+void unds_hash_set_clear(unds_hash_set_t* ths);
+
+/**
+ * 배열을 기반으로 구현된 가변 크기 힙큐
+ */
+struct unds_heap_queue_t
+{
+    /**
+     * 실제 데이터를 저장할 공간에 대한 포인터
+     */
+    void* arr;
+    /**
+     * 힙큐의 한계 용량
+     */
+    size_t capacity;
+    /**
+     * 힙큐의 크기
+     */
+    size_t size;
+    /**
+     * 힙큐 단일 요소의 크기
+     */
+    size_t of_size;
+
+    /**
+     * 힙큐 연산 시에 사용되는 요소 비교 함수
+     */
+    int (*comp)(const void* p, const void* q);
+};
+
+typedef struct unds_heap_queue_t unds_heap_queue_t;
+
+/**
+ * @brief 새로운 힙큐 생성
+ * @param of_size 힙큐에 저장할 단일 요소의 크기
+ * @param comp 힙큐 연산 시에 사용되는 요소 비교 함수 (음수를 반환하면 p가 q보다 앞선다.)
+ * @return 동적으로 생성된 힙큐의 주소
+ */
+unds_heap_queue_t* unds_heap_queue_create(size_t of_size, int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 배열로부터 새로운 힙큐 생성
+ * @param arr 힙큐로 생성할 배열의 포인터
+ * @param size 힙큐로 생성할 배열의 길이
+ * @param of_size 힙큐로 생성할 배열의 단일 요소의 크기
+ * @return 동적으로 생성된 힙큐의 주소
+ */
+unds_heap_queue_t* unds_heap_queue_create_from_array(void* arr, size_t size, size_t of_size, int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 기본값을 설정하여 새로운 힙큐 생성
+ * @param value 힙큐의 기본값으로 설정할 값의 포인터
+ * @param size 생성할 힙큐의 길이
+ * @param of_size 힙큐의 기본값으로 설정할 값의 크기
+ * @return 동적으로 생성된 힙큐의 주소
+ */
+unds_heap_queue_t* unds_heap_queue_create_from_value(void* value, size_t size, size_t of_size, int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 힙큐 삭제
+ * @param ths 대상 힙큐 포인터
+ */
+void unds_heap_queue_delete(unds_heap_queue_t* ths);
+
+/**
+ * @brief 힙큐가 비었는지 여부 반환
+ * @param ths 대상 힙큐 포인터
+ * @return 힙큐 빔 여부
+ */
+bool unds_heap_queue_empty(unds_heap_queue_t* ths);
+
+/**
+ * @brief 힙큐에 새로운 요소 삽입
+ * @param ths 대상 덱 포인터
+ * @param value 삽입할 대상을 가리키는 포인터
+ */
+void unds_heap_queue_push(unds_heap_queue_t* ths, void* value);
+
+/**
+ * @brief 힙큐의 첫 요소를 삭제
+ * @param ths 대상 힙큐 포인터
+ */
+void unds_heap_queue_pop(unds_heap_queue_t* ths);
+
+/**
+ * @brief 힙큐의 첫 요소를 dest에 복사
+ * @param ths 대상 힙큐 포인터
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_heap_queue_front(unds_heap_queue_t* ths, void* dest);
+
+/**
+ * @brief 힙큐 초기화
+ * @param ths 대상 힙큐 포인터
+ */
+void unds_heap_queue_clear(unds_heap_queue_t* ths);
+
+/**
+ * 이미 충분한 용량을 가지고 있다면 아무 것도 하지 않는다.
+ * 용량은 capacity개의 요소를 재할당 없이 삽입할 수 있는 2의 제곱수로 맞춘다.
+ *
+ * @brief 힙큐의 용량을 미리 확보
+ * @param ths 대상 힙큐 포인터
+ * @param capacity 확보할 요소의 개수
+ */
+void unds_heap_queue_reserve(unds_heap_queue_t* ths, size_t capacity);
+
+/**
+ * @brief 힙큐의 용량을 현재 크기에 맞게 감소
+ * @param ths 대상 힙큐 포인터
+ */
+void unds_heap_queue_shrink_to_fit(unds_heap_queue_t* ths);
+
+/**
+ * 삽입할 요소가 많으면 하나씩 위로 올리는 대신 전체를 한 번에 힙으로 변환한다.
+ *
+ * @brief 힙큐에 배열의 요소를 한 번에 삽입
+ * @param ths 대상 힙큐 포인터
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 개수
+ */
+void unds_heap_queue_push_n(unds_heap_queue_t* ths, void* arr, size_t n);
+
+/**
+ * arr와 size를 직접 채운 뒤 호출하면 요소를 하나씩 삽입하는 대신 O(n)으로 힙을 만들 수 있다.
+ *
+ * @brief 힙큐의 배열 전체를 다시 힙으로 변환
+ * @param ths 대상 힙큐 포인터
+ */
+void unds_heap_queue_heapify(unds_heap_queue_t* ths);
+
+/**
+ * other의 요소를 ths의 배열 뒤에 이어 붙인 뒤 전체를 O(n)으로 다시 힙으로 만든다.
+ * 호출 후 other는 비어 있으며 계속 사용할 수 있다. (ths와 other가 같으면 아무것도 하지 않는다.)
+ *
+ * @brief 두 힙큐를 병합
+ * @param ths 병합된 요소를 담을 힙큐 포인터
+ * @param other 요소를 넘겨줄 힙큐 포인터 (of_size가 ths와 같아야 한다.)
+ */
+void unds_heap_queue_merge(unds_heap_queue_t* ths, unds_heap_queue_t* other);
+
+/**
+ * 스트림에서 비교 함수상 가장 앞선 k개의 요소만 모으는 수집기
+ *
+ * 모은 요소 중 가장 뒤처진 요소를 뿌리에 두는 크기 k의 힙을 사용하므로,
+ * 후보가 아닌 요소는 뿌리와 한 번만 비교하고 버린다. 메모리는 k개의 요소만큼만 사용한다.
+ */
+struct unds_top_k_t
+{
+    /**
+     * 힙을 저장할 공간에 대한 포인터
+     */
+    void* arr;
+    /**
+     * 모을 요소의 최대 개수
+     */
+    size_t k;
+    /**
+     * 모은 요소의 개수
+     */
+    size_t size;
+    /**
+     * 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 요소 비교 함수 (qsort의 comp와 동일, 작은 요소가 앞선다.)
+     */
+    int (*comp)(const void* p, const void* q);
+};
+
+typedef struct unds_top_k_t unds_top_k_t;
+
+/**
+ * @brief 새로운 상위 k개 수집기 생성
+ * @param of_size 수집할 단일 요소의 크기
+ * @param k 모을 요소의 최대 개수
+ * @param comp 요소 비교 함수 (qsort의 comp와 동일, 작은 요소가 앞선다.)
+ * @return 동적으로 생성된 수집기의 주소
+ */
+unds_top_k_t* unds_top_k_create(size_t of_size, size_t k, int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 상위 k개 수집기 삭제
+ * @param ths 대상 수집기 포인터
+ */
+void unds_top_k_delete(unds_top_k_t* ths);
+
+/**
+ * @brief 상위 k개 수집기가 비었는지 여부 반환
+ * @param ths 대상 수집기 포인터
+ * @return 수집기 빔 여부
+ */
+bool unds_top_k_empty(unds_top_k_t* ths);
+
+/**
+ * @brief 상위 k개 수집기가 모은 요소의 개수 반환
+ * @param ths 대상 수집기 포인터
+ * @return 모은 요소의 개수
+ */
+size_t unds_top_k_size(unds_top_k_t* ths);
+
+/**
+ * @brief 상위 k개 수집기에 요소를 제시
+ * @param ths 대상 수집기 포인터
+ * @param value 제시할 값의 포인터
+ * @return 모은 요소에 들어갔는지 여부
+ */
+bool unds_top_k_push(unds_top_k_t* ths, void* value);
+
+/**
+ * @brief 상위 k개 수집기에 배열의 요소를 차례로 제시
+ * @param ths 대상 수집기 포인터
+ * @param arr 제시할 배열의 포인터
+ * @param n 제시할 요소의 개수
+ */
+void unds_top_k_push_n(unds_top_k_t* ths, void* arr, size_t n);
+
+/**
+ * k개를 모두 모은 뒤에는 이 요소보다 앞서지 않는 요소는 버려진다.
+ *
+ * @brief 모은 요소 중 가장 뒤처진 요소를 dest에 복사
+ * @param ths 대상 수집기 포인터
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_top_k_threshold(unds_top_k_t* ths, void* dest);
+
+/**
+ * 수집기의 상태는 바뀌지 않는다.
+ *
+ * @brief 모은 요소를 앞선 순서대로 정렬하여 dest에 복사
+ * @param ths 대상 수집기 포인터
+ * @param dest 요소를 복사할 목적지 (unds_top_k_size개의 요소를 담을 수 있어야 한다.)
+ */
+void unds_top_k_sorted(unds_top_k_t* ths, void* dest);
+
+/**
+ * @brief 상위 k개 수집기 초기화
+ * @param ths 대상 수집기 포인터
+ */
+void unds_top_k_clear(unds_top_k_t* ths);
+
+/**
+ * *내부 상수
+ *
+ * 페어링 힙 노드와 값의 정렬 단위
+ */
+#define __UNDS_PAIRING_HEAP_ALIGN 16
+/**
+ * *내부 상수
+ *
+ * 페어링 힙이 처음 할당하는 블록의 노드 개수
+ */
+#define __UNDS_PAIRING_HEAP_MIN_BLOCK 16
+
+/**
+ * 페어링 힙의 노드 (값은 노드 바로 뒤에 저장된다.)
+ */
+struct unds_pairing_heap_node_t
+{
+    /**
+     * 첫 자식 노드
+     */
+    struct unds_pairing_heap_node_t* child;
+    /**
+     * 다음 형제 노드 (빈 노드이면 다음 빈 노드)
+     */
+    struct unds_pairing_heap_node_t* next;
+    /**
+     * 첫 자식이면 부모 노드, 아니면 이전 형제 노드
+     */
+    struct unds_pairing_heap_node_t* prev;
+};
+
+typedef struct unds_pairing_heap_node_t unds_pairing_heap_node_t;
+
+/**
+ * *내부 자료형
+ *
+ * 페어링 힙의 노드를 담는 블록 (노드는 블록 헤더 바로 뒤에 이어진다.)
+ */
+struct __unds_pairing_heap_block_t
+{
+    /**
+     * 다음 블록
+     */
+    struct __unds_pairing_heap_block_t* next;
+};
+
+/**
+ * 노드 풀을 사용하는 페어링 힙
+ *
+ * 삽입과 병합(meld)은 O(1), 첫 요소 삭제와 키 감소는 분할 상환 O(log n)이다.
+ * 노드는 블록 단위로 할당하여 재사용하며, 병합할 때는 블록과 빈 노드 목록을 그대로 넘겨받으므로
+ * 요소를 복사하지 않고 노드 핸들도 그대로 유효하다.
+ * 비교 함수는 unds_heap_queue_t와 같이 작은 요소가 앞선다.
+ */
+struct unds_pairing_heap_t
+{
+    /**
+     * 뿌리 노드
+     */
+    unds_pairing_heap_node_t* root;
+    /**
+     * 할당한 블록의 목록
+     */
+    struct __unds_pairing_heap_block_t* blocks;
+    /**
+     * 마지막으로 연결된 블록 (병합할 때 블록 목록을 잇는 데 사용한다.)
+     */
+    struct __unds_pairing_heap_block_t* blocks_tail;
+    /**
+     * 첫 빈 노드
+     */
+    unds_pairing_heap_node_t* free_head;
+    /**
+     * 마지막 빈 노드
+     */
+    unds_pairing_heap_node_t* free_tail;
+    /**
+     * 힙의 크기
+     */
+    size_t size;
+    /**
+     * 할당한 노드의 개수
+     */
+    size_t capacity;
+    /**
+     * 힙 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 값을 포함한 노드 하나의 크기
+     */
+    size_t node_size;
+    /**
+     * 요소 비교 함수 (qsort의 comp와 동일, 작은 요소가 앞선다.)
+     */
+    int (*comp)(const void* p, const void* q);
+};
+
+typedef struct unds_pairing_heap_t unds_pairing_heap_t;
+
+/**
+ * @brief 새로운 페어링 힙 생성
+ * @param of_size 힙에 저장할 단일 요소의 크기
+ * @param comp 요소 비교 함수 (qsort의 comp와 동일, 작은 요소가 앞선다.)
+ * @return 동적으로 생성된 페어링 힙의 주소
+ */
+unds_pairing_heap_t* unds_pairing_heap_create(size_t of_size, int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 페어링 힙 삭제
+ * @param ths 대상 페어링 힙 포인터
+ */
+void unds_pairing_heap_delete(unds_pairing_heap_t* ths);
+
+/**
+ * @brief 페어링 힙이 비었는지 여부 반환
+ * @param ths 대상 페어링 힙 포인터
+ * @return 페어링 힙 빔 여부
+ */
+bool unds_pairing_heap_empty(unds_pairing_heap_t* ths);
+
+/**
+ * @brief 페어링 힙의 크기 반환
+ * @param ths 대상 페어링 힙 포인터
+ * @return 페어링 힙의 크기
+ */
+size_t unds_pairing_heap_size(unds_pairing_heap_t* ths);
+
+/**
+ * 반환한 핸들은 해당 요소가 삭제될 때까지 유효하다.
+ *
+ * @brief 페어링 힙에 새로운 요소 삽입
+ * @param ths 대상 페어링 힙 포인터
+ * @param value 삽입할 값의 포인터
+ * @return 삽입한 요소의 노드 핸들
+ */
+unds_pairing_heap_node_t* unds_pairing_heap_push(unds_pairing_heap_t* ths, void* value);
+
+/**
+ * @brief 페어링 힙의 첫 요소를 삭제
+ * @param ths 대상 페어링 힙 포인터
+ */
+void unds_pairing_heap_pop(unds_pairing_heap_t* ths);
+
+/**
+ * @brief 페어링 힙의 첫 요소를 dest에 복사
+ * @param ths 대상 페어링 힙 포인터
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_pairing_heap_front(unds_pairing_heap_t* ths, void* dest);
+
+/**
+ * @brief 노드 핸들이 가리키는 요소를 dest에 복사
+ * @param ths 대상 페어링 힙 포인터
+ * @param node 요소의 노드 핸들
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_pairing_heap_get(unds_pairing_heap_t* ths, unds_pairing_heap_node_t* node, void* dest);
+
+/**
+ * 새 값은 기존 값보다 앞서거나 같아야 한다.
+ *
+ * @brief 노드 핸들이 가리키는 요소의 키를 감소
+ * @param ths 대상 페어링 힙 포인터
+ * @param node 요소의 노드 핸들
+ * @param value 새 값의 포인터
+ */
+void unds_pairing_heap_decrease(unds_pairing_heap_t* ths, unds_pairing_heap_node_t* node, void* value);
+
+/**
+ * other의 노드와 블록을 그대로 넘겨받으므로 other의 노드 핸들은 ths에서 계속 유효하다.
+ * 호출 후 other는 비어 있으며 계속 사용할 수 있다.
+ *
+ * @brief 두 페어링 힙을 O(1)로 병합
+ * @param ths 병합된 요소를 담을 페어링 힙 포인터
+ * @param other 요소를 넘겨줄 페어링 힙 포인터 (of_size가 ths와 같아야 한다.)
+ */
+void unds_pairing_heap_meld(unds_pairing_heap_t* ths, unds_pairing_heap_t* other);
+
+/**
+ * 할당한 블록은 모두 해제한다.
+ *
+ * @brief 페어링 힙 초기화
+ * @param ths 대상 페어링 힙 포인터
+ */
+void unds_pairing_heap_clear(unds_pairing_heap_t* ths);
+
+/**
+ * 배열을 기반으로 구현된 가변 크기 최소-최대 힙 (양쪽 우선순위 큐)
+ *
+ * 짝수 깊이의 노드는 자손 중 가장 앞선 요소, 홀수 깊이의 노드는 가장 뒤처진 요소를 가진다.
+ * 따라서 가장 앞선 요소는 뿌리에, 가장 뒤처진 요소는 뿌리의 자식 중 하나에 있다.
+ * 요소 모델과 비교 함수는 unds_heap_queue_t와 같다.
+ */
+struct unds_min_max_heap_t
+{
+    /**
+     * 실제 데이터를 저장할 공간에 대한 포인터
+     */
+    void* arr;
+    /**
+     * 힙의 한계 용량
+     */
+    size_t capacity;
+    /**
+     * 힙의 크기
+     */
+    size_t size;
+    /**
+     * 힙 단일 요소의 크기
+     */
+    size_t of_size;
+
+    /**
+     * 힙 연산 시에 사용되는 요소 비교 함수 (qsort의 comp와 동일, 작은 요소가 앞선다.)
+     */
+    int (*comp)(const void* p, const void* q);
+};
+
+typedef struct unds_min_max_heap_t unds_min_max_heap_t;
+
+/**
+ * @brief 새로운 최소-최대 힙 생성
+ * @param of_size 힙에 저장할 단일 요소의 크기
+ * @param comp 힙 연산 시에 사용되는 요소 비교 함수
+ * @return 동적으로 생성된 최소-최대 힙의 주소
+ */
+unds_min_max_heap_t* unds_min_max_heap_create(size_t of_size, int (*comp)(const void* p, const void* q));
+
+/**
+ * 요소를 하나씩 삽입하지 않고 O(size)로 힙을 만든다.
+ *
+ * @brief 배열로부터 새로운 최소-최대 힙 생성
+ * @param arr 힙으로 생성할 배열의 포인터
+ * @param size 힙으로 생성할 배열의 길이
+ * @param of_size 힙으로 생성할 배열의 단일 요소의 크기
+ * @param comp 힙 연산 시에 사용되는 요소 비교 함수
+ * @return 동적으로 생성된 최소-최대 힙의 주소
+ */
+unds_min_max_heap_t* unds_min_max_heap_create_from_array(void* arr, size_t size, size_t of_size, int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 최소-최대 힙 삭제
+ * @param ths 대상 최소-최대 힙 포인터
+ */
+void unds_min_max_heap_delete(unds_min_max_heap_t* ths);
+
+/**
+ * @brief 최소-최대 힙이 비었는지 여부 반환
+ * @param ths 대상 최소-최대 힙 포인터
+ * @return 최소-최대 힙 빔 여부
+ */
+bool unds_min_max_heap_empty(unds_min_max_heap_t* ths);
+
+/**
+ * @brief 최소-최대 힙의 크기 반환
+ * @param ths 대상 최소-최대 힙 포인터
+ * @return 최소-최대 힙의 크기
+ */
+size_t unds_min_max_heap_size(unds_min_max_heap_t* ths);
+
+/**
+ * @brief 최소-최대 힙에 새로운 요소 삽입
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param value 삽입할 대상을 가리키는 포인터
+ */
+void unds_min_max_heap_push(unds_min_max_heap_t* ths, void* value);
+
+/**
+ * @brief 최소-최대 힙의 가장 앞선 요소를 dest에 복사
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_min_max_heap_front_min(unds_min_max_heap_t* ths, void* dest);
+
+/**
+ * @brief 최소-최대 힙의 가장 뒤처진 요소를 dest에 복사
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_min_max_heap_front_max(unds_min_max_heap_t* ths, void* dest);
+
+/**
+ * @brief 최소-최대 힙의 가장 앞선 요소를 삭제
+ * @param ths 대상 최소-최대 힙 포인터
+ */
+void unds_min_max_heap_pop_min(unds_min_max_heap_t* ths);
+
+/**
+ * @brief 최소-최대 힙의 가장 뒤처진 요소를 삭제
+ * @param ths 대상 최소-최대 힙 포인터
+ */
+void unds_min_max_heap_pop_max(unds_min_max_heap_t* ths);
+
+/**
+ * @brief 최소-최대 힙 초기화
+ * @param ths 대상 최소-최대 힙 포인터
+ */
+void unds_min_max_heap_clear(unds_min_max_heap_t* ths);
+
+/**
+ * 이미 충분한 용량을 가지고 있다면 아무 것도 하지 않는다.
+ *
+ * @brief 최소-최대 힙의 용량을 미리 확보
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param capacity 확보할 요소의 개수
+ */
+void unds_min_max_heap_reserve(unds_min_max_heap_t* ths, size_t capacity);
+
+/**
+ * @brief 최소-최대 힙의 용량을 현재 크기에 맞게 감소
+ * @param ths 대상 최소-최대 힙 포인터
+ */
+void unds_min_max_heap_shrink_to_fit(unds_min_max_heap_t* ths);
+
+/**
+ * 배열을 기반으로 구현된 가변 크기 큐
+ */
+struct unds_queue_t
+{
+    /**
+     * 실제 데이터를 저장할 공간에 대한 포인터
+     */
+    void* arr;
+    /**
+     * 큐의 한계 용량
+     */
+    size_t capacity;
+    /**
+     * 큐의 크기
+     */
+    size_t size;
+    /**
+     * 큐 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 큐의 앞부분을 나타내는 카운터 (실제 위치는 head & (capacity - 1))
+     */
+    size_t head;
+    /**
+     * 큐의 뒷부분을 나타내는 카운터 (실제 위치는 tail & (capacity - 1), tail - head == size)
+     */
+    size_t tail;
+    /**
+     * 구조체와 함께 할당된 내장 공간 또는 init에 전달된 공간 (없으면 NULL)
+     */
+    void* inline_arr;
+    /**
+     * 내장 공간의 용량 (용량이 이보다 작아지지 않으며, 이하일 때는 힙을 사용하지 않는다.)
+     */
+    size_t inline_capacity;
+};
+
+typedef struct unds_queue_t unds_queue_t;
+
+/**
+ * @brief 새로운 큐 생성
+ * @param of_size 큐에 저장할 단일 요소의 크기
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_queue_t* unds_queue_create(size_t of_size);
+
+/**
+ * @brief 배열로부터 새로운 큐 생성
+ * @param arr 큐로 생성할 배열의 포인터
+ * @param size 큐로 생성할 배열의 길이
+ * @param of_size 큐로 생성할 배열의 단일 요소의 크기
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_queue_t* unds_queue_create_from_array(void* arr, size_t size, size_t of_size);
+
+/**
+ * @brief 기본값을 설정하여 새로운 큐 생성
+ * @param value 큐의 기본값으로 설정할 값의 포인터
+ * @param size 생성할 큐의 길이
+ * @param of_size 큐의 기본값으로 설정할 값의 크기
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_queue_t* unds_queue_create_from_value(void* value, size_t size, size_t of_size);
+
+/**
+ * 구조체 뒤에 capacity개의 요소를 담을 내장 공간을 붙여 한 번에 할당한다.
+ * 요소가 내장 공간에 들어가는 동안에는 힙을 더 사용하지 않으며, 넘치면 힙으로 옮긴다.
+ * 내장 공간의 용량은 2의 제곱수로 내림한다.
+ *
+ * @brief 내장 공간을 가진 새로운 큐 생성
+ * @param of_size 큐에 저장할 단일 요소의 크기
+ * @param capacity 내장 공간에 저장할 요소의 개수
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_queue_t* unds_queue_create_inline(size_t of_size, size_t capacity);
+
+/**
+ * ths와 storage는 호출한 쪽이 소유하므로, 지역 변수로 선언하면
+ * 요소가 storage에 들어가는 동안 힙을 전혀 사용하지 않는다.
+ * unds_queue_delete 대신 unds_queue_deinit으로 정리해야 한다.
+ *
+ * -> int 요소 16개까지는 힙을 사용하지 않는 큐.
+ *    int storage[16];
+ *    unds_queue_t queue;
+ *    unds_queue_init(&queue, sizeof(int), storage, 16);
+ *    ...
+ *    unds_queue_deinit(&queue);
+ *
+ * @brief 호출한 쪽의 공간을 내장 공간으로 사용하여 큐 초기화
+ * @param ths 초기화할 큐 포인터
+ * @param of_size 큐에 저장할 단일 요소의 크기
+ * @param storage 내장 공간으로 사용할 공간의 포인터 (NULL이면 힙만 사용)
+ * @param capacity storage에 저장할 수 있는 요소의 개수 (2의 제곱수로 내림)
+ */
+void unds_queue_init(unds_queue_t* ths, size_t of_size, void* storage, size_t capacity);
+
+/**
+ * @brief unds_queue_init으로 초기화한 큐가 사용한 힙 공간 해제
+ * @param ths 대상 큐 포인터
+ */
+void unds_queue_deinit(unds_queue_t* ths);
+
+/**
+ * @brief 큐 삭제
+ * @param ths 대상 큐 포인터
+ */
+void unds_queue_delete(unds_queue_t* ths);
+
+/**
+ * @brief 큐이 비었는지 여부 반환
+ * @param ths 대상 큐 포인터
+ * @return 큐 빔 여부
+ */
+bool unds_queue_empty(unds_queue_t* ths);
+
+/**
+ * @brief 큐에 새로운 요소 삽입
+ * @param ths 대상 큐 포인터
+ * @param value 삽입할 대상을 가리키는 포인터
+ */
+void unds_queue_push(unds_queue_t* ths, void* value);
+
+/**
+ * @brief 큐의 첫 요소를 삭제
+ * @param ths 대상 큐 포인터
+ */
+void unds_queue_pop(unds_queue_t* ths);
+
+/**
+ * @brief 큐의 첫 요소를 dest에 복사
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_queue_front(unds_queue_t* ths, void* dest);
+
+/**
+ * @brief 큐의 마지막 요소를 dest에 복사
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_queue_back(unds_queue_t* ths, void* dest);
+
+/**
+ * @brief 큐 초기화
+ * @param ths 대상 큐 포인터
+ */
+void unds_queue_clear(unds_queue_t* ths);
+
+/**
+ * 이미 충분한 용량을 가지고 있다면 아무 것도 하지 않는다.
+ * 용량은 capacity개의 요소를 재할당 없이 삽입할 수 있는 2의 제곱수로 맞춘다.
+ *
+ * @brief 큐의 용량을 미리 확보
+ * @param ths 대상 큐 포인터
+ * @param capacity 확보할 요소의 개수
+ */
+void unds_queue_reserve(unds_queue_t* ths, size_t capacity);
+
+/**
+ * @brief 큐의 용량을 현재 크기에 맞게 감소
+ * @param ths 대상 큐 포인터
+ */
+void unds_queue_shrink_to_fit(unds_queue_t* ths);
+
+/**
+ * @brief 큐에 배열의 요소를 한 번에 삽입
+ * @param ths 대상 큐 포인터
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 개수
+ */
+void unds_queue_push_n(unds_queue_t* ths, void* arr, size_t n);
+
+/**
+ * dest에는 삭제되는 요소가 큐에 있던 순서 그대로 복사된다.
+ * dest가 NULL이면 복사하지 않고 삭제만 한다.
+ *
+ * @brief 큐의 앞부분의 n개의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지
+ * @param n 삭제할 요소의 개수
+ */
+void unds_queue_pop_n(unds_queue_t* ths, void* dest, size_t n);
+
+#ifdef UNDS_USE_THREADS
+
+/**
+ * 생산자 스레드 하나와 소비자 스레드 하나가 잠금 없이 공유하는 고정 용량 원형 큐
+ *
+ * 생산자만 tail을, 소비자만 head를 갱신하며 서로 다른 캐시 라인에 둔다.
+ * 상대방의 인덱스는 캐시해 두고 큐가 가득 찼거나 비어 보일 때만 다시 읽는다.
+ * push 계열 함수는 생산자 스레드에서만, pop 계열 함수는 소비자 스레드에서만 호출해야 한다.
+ */
+struct unds_spsc_queue_t
+{
+    /**
+     * 실제 데이터를 저장할 공간에 대한 포인터
+     */
+    void* arr;
+    /**
+     * 큐의 용량 (2의 제곱수)
+     */
+    size_t capacity;
+    /**
+     * 큐 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 소비자가 갱신하는 앞부분 카운터 (실제 위치는 head & (capacity - 1))
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) _Atomic size_t head;
+    /**
+     * 소비자가 마지막으로 읽은 tail
+     */
+    size_t cached_tail;
+    /**
+     * 생산자가 갱신하는 뒷부분 카운터 (실제 위치는 tail & (capacity - 1))
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) _Atomic size_t tail;
+    /**
+     * 생산자가 마지막으로 읽은 head
+     */
+    size_t cached_head;
+};
+
+typedef struct unds_spsc_queue_t unds_spsc_queue_t;
+
+/**
+ * @brief 새로운 SPSC 큐 생성
+ * @param of_size 큐에 저장할 단일 요소의 크기
+ * @param capacity 큐에 저장할 수 있는 요소의 최대 개수 (2의 제곱수로 올림)
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_spsc_queue_t* unds_spsc_queue_create(size_t of_size, size_t capacity);
+
+/**
+ * 용량은 size 이상의 2의 제곱수로 정해진다.
+ *
+ * @brief 배열로부터 새로운 SPSC 큐 생성
+ * @param arr 큐로 생성할 배열의 포인터
+ * @param size 큐로 생성할 배열의 길이
+ * @param of_size 큐로 생성할 배열의 단일 요소의 크기
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_spsc_queue_t* unds_spsc_queue_create_from_array(void* arr, size_t size, size_t of_size);
+
+/**
+ * 용량은 size 이상의 2의 제곱수로 정해진다.
+ *
+ * @brief 기본값을 설정하여 새로운 SPSC 큐 생성
+ * @param value 큐의 기본값으로 설정할 값의 포인터
+ * @param size 생성할 큐의 길이
+ * @param of_size 큐의 기본값으로 설정할 값의 크기
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_spsc_queue_t* unds_spsc_queue_create_from_value(void* value, size_t size, size_t of_size);
+
+/**
+ * 다른 스레드가 더 이상 큐를 사용하지 않을 때 호출해야 한다.
+ *
+ * @brief SPSC 큐 삭제
+ * @param ths 대상 큐 포인터
+ */
+void unds_spsc_queue_delete(unds_spsc_queue_t* ths);
+
+/**
+ * 다른 스레드가 동시에 삽입, 삭제 중이면 호출한 시점의 근사값이다.
+ *
+ * @brief SPSC 큐가 비었는지 여부 반환
+ * @param ths 대상 큐 포인터
+ * @return 큐 빔 여부
+ */
+bool unds_spsc_queue_empty(unds_spsc_queue_t* ths);
+
+/**
+ * 다른 스레드가 동시에 삽입, 삭제 중이면 호출한 시점의 근사값이다.
+ *
+ * @brief SPSC 큐의 크기 반환
+ * @param ths 대상 큐 포인터
+ * @return 큐의 크기
+ */
+size_t unds_spsc_queue_size(unds_spsc_queue_t* ths);
+
+/**
+ * 다른 스레드가 큐를 사용하지 않을 때만 호출해야 한다.
+ *
+ * @brief SPSC 큐 초기화
+ * @param ths 대상 큐 포인터
+ */
+void unds_spsc_queue_clear(unds_spsc_queue_t* ths);
+
+/**
+ * @brief SPSC 큐의 뒷부분에 요소 삽입 시도 (생산자 전용)
+ * @param ths 대상 큐 포인터
+ * @param value 삽입할 값의 포인터
+ * @return 삽입 여부 (큐가 가득 차 있으면 false)
+ */
+bool unds_spsc_queue_try_push(unds_spsc_queue_t* ths, void* value);
+
+/**
+ * @brief SPSC 큐의 앞부분의 요소를 dest에 복사하고 삭제 시도 (소비자 전용)
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @return 삭제 여부 (큐가 비어 있으면 false)
+ */
+bool unds_spsc_queue_try_pop(unds_spsc_queue_t* ths, void* dest);
+
+/**
+ * 빈 자리만큼만 삽입하며, 삽입한 요소들은 한 번에 소비자에게 보인다.
+ *
+ * @brief SPSC 큐에 배열의 요소를 최대 n개 삽입 (생산자 전용)
+ * @param ths 대상 큐 포인터
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 최대 개수
+ * @return 삽입한 요소의 개수
+ */
+size_t unds_spsc_queue_push_n(unds_spsc_queue_t* ths, void* arr, size_t n);
+
+/**
+ * @brief SPSC 큐의 앞부분의 요소를 최대 n개 dest에 복사하고 삭제 (소비자 전용)
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @param n 삭제할 요소의 최대 개수
+ * @return 삭제한 요소의 개수
+ */
+size_t unds_spsc_queue_pop_n(unds_spsc_queue_t* ths, void* dest, size_t n);
+
+/**
+ * 여러 생산자 스레드와 여러 소비자 스레드가 공유하는 고정 용량 원형 큐
+ *
+ * 각 칸이 순서 번호를 가지며, 순서 번호가 위치와 같은 칸에는 삽입할 수 있고
+ * 위치 + 1과 같은 칸에서는 삭제할 수 있다. 위치는 CAS로 예약하므로 잠금이 필요 없다.
+ * 블로킹 함수는 대기하는 스레드가 있을 때만 깨우기 비용을 지불한다.
+ */
+struct unds_mpmc_queue_t
+{
+    /**
+     * 순서 번호와 요소로 이루어진 칸들의 배열
+     */
+    void* cells;
+    /**
+     * 큐의 용량 (2의 제곱수)
+     */
+    size_t capacity;
+    /**
+     * 큐 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 순서 번호를 포함한 칸 하나의 크기
+     */
+    size_t cell_size;
+    /**
+     * 다음에 삽입할 위치
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) _Atomic size_t tail;
+    /**
+     * 다음에 삭제할 위치
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) _Atomic size_t head;
+    /**
+     * 요소가 삽입될 때마다 바뀌는 대기용 값 (대기 중인 소비자가 있을 때만 바뀐다.)
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) _Atomic unsigned int not_empty;
+    /**
+     * 요소를 기다리는 소비자의 수
+     */
+    _Atomic unsigned int not_empty_waiters;
+    /**
+     * 요소가 삭제될 때마다 바뀌는 대기용 값 (대기 중인 생산자가 있을 때만 바뀐다.)
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) _Atomic unsigned int not_full;
+    /**
+     * 빈 자리를 기다리는 생산자의 수
+     */
+    _Atomic unsigned int not_full_waiters;
+};
+
+typedef struct unds_mpmc_queue_t unds_mpmc_queue_t;
+
+/**
+ * @brief 새로운 MPMC 큐 생성
+ * @param of_size 큐에 저장할 단일 요소의 크기
+ * @param capacity 큐에 저장할 수 있는 요소의 최대 개수 (2 이상의 2의 제곱수로 올림)
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_mpmc_queue_t* unds_mpmc_queue_create(size_t of_size, size_t capacity);
+
+/**
+ * 용량은 size 이상의 2의 제곱수로 정해진다.
+ *
+ * @brief 배열로부터 새로운 MPMC 큐 생성
+ * @param arr 큐로 생성할 배열의 포인터
+ * @param size 큐로 생성할 배열의 길이
+ * @param of_size 큐로 생성할 배열의 단일 요소의 크기
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_mpmc_queue_t* unds_mpmc_queue_create_from_array(void* arr, size_t size, size_t of_size);
+
+/**
+ * 용량은 size 이상의 2의 제곱수로 정해진다.
+ *
+ * @brief 기본값을 설정하여 새로운 MPMC 큐 생성
+ * @param value 큐의 기본값으로 설정할 값의 포인터
+ * @param size 생성할 큐의 길이
+ * @param of_size 큐의 기본값으로 설정할 값의 크기
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_mpmc_queue_t* unds_mpmc_queue_create_from_value(void* value, size_t size, size_t of_size);
+
+/**
+ * 다른 스레드가 더 이상 큐를 사용하지 않을 때 호출해야 한다.
+ *
+ * @brief MPMC 큐 삭제
+ * @param ths 대상 큐 포인터
+ */
+void unds_mpmc_queue_delete(unds_mpmc_queue_t* ths);
+
+/**
+ * 다른 스레드가 동시에 삽입, 삭제 중이면 호출한 시점의 근사값이다.
+ *
+ * @brief MPMC 큐가 비었는지 여부 반환
+ * @param ths 대상 큐 포인터
+ * @return 큐 빔 여부
+ */
+bool unds_mpmc_queue_empty(unds_mpmc_queue_t* ths);
+
+/**
+ * 다른 스레드가 동시에 삽입, 삭제 중이면 호출한 시점의 근사값이다.
+ *
+ * @brief MPMC 큐의 크기 반환
+ * @param ths 대상 큐 포인터
+ * @return 큐의 크기
+ */
+size_t unds_mpmc_queue_size(unds_mpmc_queue_t* ths);
+
+/**
+ * 다른 스레드가 큐를 사용하지 않을 때만 호출해야 한다.
+ *
+ * @brief MPMC 큐 초기화
+ * @param ths 대상 큐 포인터
+ */
+void unds_mpmc_queue_clear(unds_mpmc_queue_t* ths);
+
+/**
+ * @brief MPMC 큐의 뒷부분에 요소 삽입 시도
+ * @param ths 대상 큐 포인터
+ * @param value 삽입할 값의 포인터
+ * @return 삽입 여부 (큐가 가득 차 있으면 false)
+ */
+bool unds_mpmc_queue_try_push(unds_mpmc_queue_t* ths, void* value);
+
+/**
+ * @brief MPMC 큐의 앞부분의 요소를 dest에 복사하고 삭제 시도
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @return 삭제 여부 (큐가 비어 있으면 false)
+ */
+bool unds_mpmc_queue_try_pop(unds_mpmc_queue_t* ths, void* dest);
+
+/**
+ * 큐가 가득 차 있으면 빈 자리가 생길 때까지 대기한다.
+ *
+ * @brief MPMC 큐의 뒷부분에 요소 삽입
+ * @param ths 대상 큐 포인터
+ * @param value 삽입할 값의 포인터
+ */
+void unds_mpmc_queue_push(unds_mpmc_queue_t* ths, void* value);
+
+/**
+ * 큐가 비어 있으면 요소가 삽입될 때까지 대기한다.
+ *
+ * @brief MPMC 큐의 앞부분의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ */
+void unds_mpmc_queue_pop(unds_mpmc_queue_t* ths, void* dest);
+
+/**
+ * *내부 자료형
+ *
+ * 작업 훔치기 덱의 원형 배열 (크기를 늘릴 때 이전 배열은 덱을 삭제할 때까지 남겨 둔다.)
+ */
+struct __unds_work_stealing_array_t
+{
+    /**
+     * 배열의 용량 (2의 제곱수)
+     */
+    size_t capacity;
+    /**
+     * 크기를 늘리기 전의 배열
+     */
+    struct __unds_work_stealing_array_t* prev;
+    /**
+     * 요소들
+     */
+    _Atomic(void*) items[];
+};
+
+/**
+ * 소유자 스레드는 아래쪽에서 삽입, 삭제하고 다른 스레드는 위쪽에서 잠금 없이 훔쳐 가는 덱 (Chase-Lev)
+ *
+ * 요소는 NULL이 아닌 포인터이다.
+ * push, pop은 소유자 스레드에서만, steal은 어느 스레드에서나 호출할 수 있다.
+ */
+struct unds_work_stealing_deque_t
+{
+    /**
+     * 다른 스레드가 훔쳐 갈 위치
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) _Atomic intptr_t top;
+    /**
+     * 소유자가 삽입할 위치
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) _Atomic intptr_t bottom;
+    /**
+     * 현재 사용하는 원형 배열
+     */
+    _Atomic(struct __unds_work_stealing_array_t*) array;
+};
+
+typedef struct unds_work_stealing_deque_t unds_work_stealing_deque_t;
+
+/**
+ * @brief 새로운 작업 훔치기 덱 생성
+ * @param capacity 처음 용량 (2의 제곱수로 올림, 가득 차면 소유자가 두 배로 늘린다.)
+ * @return 동적으로 생성된 덱의 주소
+ */
+unds_work_stealing_deque_t* unds_work_stealing_deque_create(size_t capacity);
+
+/**
+ * 다른 스레드가 더 이상 덱을 사용하지 않을 때 호출해야 한다.
+ *
+ * @brief 작업 훔치기 덱 삭제
+ * @param ths 대상 덱 포인터
+ */
+void unds_work_stealing_deque_delete(unds_work_stealing_deque_t* ths);
+
+/**
+ * 다른 스레드가 동시에 삽입, 삭제 중이면 호출한 시점의 근사값이다.
+ *
+ * @brief 작업 훔치기 덱의 크기 반환
+ * @param ths 대상 덱 포인터
+ * @return 덱의 크기
+ */
+size_t unds_work_stealing_deque_size(unds_work_stealing_deque_t* ths);
+
+/**
+ * 다른 스레드가 동시에 삽입, 삭제 중이면 호출한 시점의 근사값이다.
+ *
+ * @brief 작업 훔치기 덱이 비었는지 여부 반환
+ * @param ths 대상 덱 포인터
+ * @return 덱 빔 여부
+ */
+bool unds_work_stealing_deque_empty(unds_work_stealing_deque_t* ths);
+
+/**
+ * @brief 작업 훔치기 덱의 아래쪽에 요소 삽입 (소유자 전용)
+ * @param ths 대상 덱 포인터
+ * @param item 삽입할 포인터 (NULL이면 안 된다.)
+ */
+void unds_work_stealing_deque_push(unds_work_stealing_deque_t* ths, void* item);
+
+/**
+ * @brief 작업 훔치기 덱의 아래쪽에서 요소를 삭제하고 반환 (소유자 전용)
+ * @param ths 대상 덱 포인터
+ * @return 삭제한 포인터 (덱이 비어 있으면 NULL)
+ */
+void* unds_work_stealing_deque_pop(unds_work_stealing_deque_t* ths);
+
+/**
+ * 다른 스레드와 경쟁하여 실패하면 덱이 비어 있지 않아도 NULL을 반환한다.
+ *
+ * @brief 작업 훔치기 덱의 위쪽에서 요소를 삭제하고 반환
+ * @param ths 대상 덱 포인터
+ * @return 삭제한 포인터 (덱이 비어 있거나 경쟁에서 지면 NULL)
+ */
+void* unds_work_stealing_deque_steal(unds_work_stealing_deque_t* ths);
+
+typedef struct unds_task_pool_t unds_task_pool_t;
+
+/**
+ * 작업 풀에서 실행되는 함수 (pool로 하위 작업을 제출할 수 있다.)
+ */
+typedef void (*unds_task_func_t)(unds_task_pool_t* pool, void* arg);
+
+/**
+ * *내부 자료형
+ *
+ * 작업 풀의 작업자 스레드 하나의 상태
+ */
+struct __unds_task_worker_t
+{
+    /**
+     * 작업자가 소유하는 작업 훔치기 덱
+     */
+    unds_work_stealing_deque_t* deque;
+    /**
+     * 소속된 작업 풀
+     */
+    unds_task_pool_t* pool;
+    /**
+     * 훔칠 대상을 고르는 난수 상태
+     */
+    uint32_t seed;
+    /**
+     * 작업자 스레드
+     */
+    pthread_t thread;
+};
+
+/**
+ * 작업자마다 작업 훔치기 덱을 두는 스레드 풀
+ *
+ * 작업자 스레드 안에서 제출한 작업은 그 작업자의 덱에 쌓여 깊이 우선으로 실행되고,
+ * 일이 없는 작업자는 다른 작업자의 덱에서 오래된 작업부터 훔쳐 간다.
+ * 작업자 밖에서 제출한 작업은 잠금으로 보호되는 공용 큐를 거친다.
+ */
+struct unds_task_pool_t
+{
+    /**
+     * 작업자들
+     */
+    struct __unds_task_worker_t* workers;
+    /**
+     * 작업자의 수
+     */
+    size_t num_workers;
+    /**
+     * 작업자 밖에서 제출한 작업들의 큐
+     */
+    unds_queue_t* injector;
+    /**
+     * injector와 대기에 사용하는 뮤텍스
+     */
+    pthread_mutex_t mutex;
+    /**
+     * 할 일이 생겼음을 알리는 조건 변수
+     */
+    pthread_cond_t work_cond;
+    /**
+     * 모든 작업이 끝났음을 알리는 조건 변수
+     */
+    pthread_cond_t done_cond;
+    /**
+     * 제출되었지만 아직 끝나지 않은 작업의 수
+     */
+    _Atomic size_t pending;
+    /**
+     * injector에 있는 작업의 수
+     */
+    _Atomic size_t injected;
+    /**
+     * 작업이 제출될 때마다 증가하는 번호
+     */
+    _Atomic unsigned int work_seq;
+    /**
+     * work_cond에서 잠들었거나 잠들려는 작업자의 수
+     */
+    _Atomic size_t sleepers;
+    /**
+     * 작업자들의 종료 여부
+     */
+    _Atomic bool stop;
+};
+
+/**
+ * @brief 새로운 작업 풀 생성
+ * @param num_threads 작업자 스레드의 수 (0이면 온라인 CPU의 수)
+ * @return 동적으로 생성된 작업 풀의 주소
+ */
+unds_task_pool_t* unds_task_pool_create(size_t num_threads);
+
+/**
+ * 남아 있는 작업을 모두 기다린 뒤 작업자 스레드를 종료한다.
+ *
+ * @brief 작업 풀 삭제
+ * @param ths 대상 작업 풀 포인터
+ */
+void unds_task_pool_delete(unds_task_pool_t* ths);
+
+/**
+ * 작업 안에서 호출하면 현재 작업자의 덱에 쌓이므로 잠금 없이 제출된다.
+ *
+ * @brief 작업 풀에 작업 제출
+ * @param ths 대상 작업 풀 포인터
+ * @param func 실행할 함수
+ * @param arg func에 전달할 인자
+ */
+void unds_task_pool_submit(unds_task_pool_t* ths, unds_task_func_t func, void* arg);
+
+/**
+ * 작업이 제출한 하위 작업까지 모두 끝날 때까지 대기한다.
+ * 작업 안에서 호출하면 안 된다.
+ *
+ * @brief 작업 풀의 모든 작업이 끝날 때까지 대기
+ * @param ths 대상 작업 풀 포인터
+ */
+void unds_task_pool_wait(unds_task_pool_t* ths);
+
+/**
+ * 뮤텍스와 조건 변수로 보호되는 고정 용량 큐
+ *
+ * 가득 차면 push가, 비어 있으면 pop이 대기한다.
+ * 닫힌 뒤에는 삽입할 수 없으며, 남은 요소를 모두 꺼내면 pop이 대기 없이 실패한다.
+ */
+struct unds_blocking_queue_t
+{
+    /**
+     * 요소를 저장하는 큐 (용량만큼의 내장 공간을 가진다.)
+     */
+    unds_queue_t* queue;
+    /**
+     * 큐에 저장할 수 있는 요소의 최대 개수
+     */
+    size_t capacity;
+    /**
+     * 큐를 보호하는 뮤텍스
+     */
+    pthread_mutex_t mutex;
+    /**
+     * 요소가 삽입되었음을 알리는 조건 변수
+     */
+    pthread_cond_t not_empty;
+    /**
+     * 빈 자리가 생겼음을 알리는 조건 변수
+     */
+    pthread_cond_t not_full;
+    /**
+     * not_empty에서 대기 중인 스레드의 수
+     */
+    size_t pop_waiters;
+    /**
+     * not_full에서 대기 중인 스레드의 수
+     */
+    size_t push_waiters;
+    /**
+     * 닫힘 여부
+     */
+    bool closed;
+};
+
+typedef struct unds_blocking_queue_t unds_blocking_queue_t;
+
+/**
+ * @brief 새로운 블로킹 큐 생성
+ * @param of_size 큐에 저장할 단일 요소의 크기
+ * @param capacity 큐에 저장할 수 있는 요소의 최대 개수
+ * @return 동적으로 생성된 큐의 주소
+ */
+unds_blocking_queue_t* unds_blocking_queue_create(size_t of_size, size_t capacity);
+
+/**
+ * 대기 중인 스레드가 없을 때 호출해야 한다.
+ *
+ * @brief 블로킹 큐 삭제
+ * @param ths 대상 큐 포인터
+ */
+void unds_blocking_queue_delete(unds_blocking_queue_t* ths);
+
+/**
+ * @brief 블로킹 큐가 비었는지 여부 반환
+ * @param ths 대상 큐 포인터
+ * @return 큐 빔 여부
+ */
+bool unds_blocking_queue_empty(unds_blocking_queue_t* ths);
+
+/**
+ * @brief 블로킹 큐의 크기 반환
+ * @param ths 대상 큐 포인터
+ * @return 큐의 크기
+ */
+size_t unds_blocking_queue_size(unds_blocking_queue_t* ths);
+
+/**
+ * 큐가 가득 차 있으면 빈 자리가 생기거나 큐가 닫힐 때까지 대기한다.
+ *
+ * @brief 블로킹 큐의 뒷부분에 요소 삽입
+ * @param ths 대상 큐 포인터
+ * @param value 삽입할 값의 포인터
+ * @return 삽입 여부 (큐가 닫혀 있으면 false)
+ */
+bool unds_blocking_queue_push(unds_blocking_queue_t* ths, void* value);
+
+/**
+ * @brief 블로킹 큐의 뒷부분에 요소 삽입 시도
+ * @param ths 대상 큐 포인터
+ * @param value 삽입할 값의 포인터
+ * @return 삽입 여부 (큐가 가득 차 있거나 닫혀 있으면 false)
+ */
+bool unds_blocking_queue_try_push(unds_blocking_queue_t* ths, void* value);
+
+/**
+ * 큐가 비어 있으면 요소가 삽입되거나 큐가 닫힐 때까지 대기한다.
+ *
+ * @brief 블로킹 큐의 앞부분의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @return 삭제 여부 (큐가 닫혀 있고 비어 있으면 false)
+ */
+bool unds_blocking_queue_pop(unds_blocking_queue_t* ths, void* dest);
+
+/**
+ * @brief 블로킹 큐의 앞부분의 요소를 dest에 복사하고 삭제 시도
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @return 삭제 여부 (큐가 비어 있으면 false)
+ */
+bool unds_blocking_queue_try_pop(unds_blocking_queue_t* ths, void* dest);
+
+/**
+ * 큐가 비어 있으면 요소가 삽입되거나, 큐가 닫히거나, 제한 시간이 지날 때까지 대기한다.
+ *
+ * @brief 제한 시간 안에 블로킹 큐의 앞부분의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @param timeout_ms 최대 대기 시간 (밀리초)
+ * @return 삭제 여부 (시간이 지났거나 큐가 닫혀 있고 비어 있으면 false)
+ */
+bool unds_blocking_queue_pop_timeout(unds_blocking_queue_t* ths, void* dest, size_t timeout_ms);
+
+/**
+ * 대기하지 않으며, 잠금을 한 번만 잡고 최대 max개의 요소를 큐에 있던 순서대로 dest에 복사한다.
+ *
+ * @brief 블로킹 큐의 요소를 한 번에 꺼냄
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @param max 꺼낼 요소의 최대 개수
+ * @return 꺼낸 요소의 개수
+ */
+size_t unds_blocking_queue_drain(unds_blocking_queue_t* ths, void* dest, size_t max);
+
+/**
+ * 대기 중인 모든 스레드를 깨운다. 이후의 삽입은 실패하고, 남은 요소는 계속 꺼낼 수 있다.
+ *
+ * @brief 블로킹 큐 닫기
+ * @param ths 대상 큐 포인터
+ */
+void unds_blocking_queue_close(unds_blocking_queue_t* ths);
+
+/**
+ * @brief 블로킹 큐가 닫혔는지 여부 반환
+ * @param ths 대상 큐 포인터
+ * @return 닫힘 여부
+ */
+bool unds_blocking_queue_closed(unds_blocking_queue_t* ths);
+
+/**
+ * 뮤텍스 하나로 보호되는 힙큐 (항상 비교 함수상 가장 앞선 요소를 꺼낸다.)
+ *
+ * 비교 함수는 unds_heap_queue_t와 같다.
+ */
+struct unds_locked_heap_queue_t
+{
+    /**
+     * 요소를 저장하는 힙큐
+     */
+    unds_heap_queue_t* heap;
+    /**
+     * 힙큐를 보호하는 뮤텍스
+     */
+    pthread_mutex_t mutex;
+};
+
+typedef struct unds_locked_heap_queue_t unds_locked_heap_queue_t;
+
+/**
+ * @brief 새로운 잠금 힙큐 생성
+ * @param of_size 힙큐에 저장할 단일 요소의 크기
+ * @param comp 힙큐 연산 시에 사용되는 요소 비교 함수
+ * @return 동적으로 생성된 힙큐의 주소
+ */
+unds_locked_heap_queue_t* unds_locked_heap_queue_create(size_t of_size, int (*comp)(const void* p, const void* q));
+
+/**
+ * @brief 잠금 힙큐 삭제
+ * @param ths 대상 힙큐 포인터
+ */
+void unds_locked_heap_queue_delete(unds_locked_heap_queue_t* ths);
+
+/**
+ * @brief 잠금 힙큐의 크기 반환
+ * @param ths 대상 힙큐 포인터
+ * @return 힙큐의 크기
+ */
+size_t unds_locked_heap_queue_size(unds_locked_heap_queue_t* ths);
+
+/**
+ * @brief 잠금 힙큐가 비었는지 여부 반환
+ * @param ths 대상 힙큐 포인터
+ * @return 힙큐 빔 여부
+ */
+bool unds_locked_heap_queue_empty(unds_locked_heap_queue_t* ths);
+
+/**
+ * @brief 잠금 힙큐에 요소 삽입
+ * @param ths 대상 힙큐 포인터
+ * @param value 삽입할 값의 포인터
+ */
+void unds_locked_heap_queue_push(unds_locked_heap_queue_t* ths, void* value);
+
+/**
+ * @brief 잠금 힙큐의 가장 앞선 요소를 dest에 복사하고 삭제 시도
+ * @param ths 대상 힙큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @return 삭제 여부 (힙큐가 비어 있으면 false)
+ */
+bool unds_locked_heap_queue_try_pop(unds_locked_heap_queue_t* ths, void* dest);
+
+/**
+ * *내부 자료형
+ *
+ * 멀티큐를 이루는 힙큐 하나 (서로 다른 캐시 라인에 둔다.)
+ */
+struct __unds_multi_queue_lane_t
+{
+    /**
+     * 힙큐를 보호하는 뮤텍스
+     */
+    _Alignas(UNDS_CACHE_LINE_SIZE) pthread_mutex_t mutex;
+    /**
+     * 요소를 저장하는 힙큐
+     */
+    unds_heap_queue_t* heap;
+    /**
+     * 힙큐의 크기 (잠금 없이 빈 힙큐를 건너뛰기 위해 따로 둔다.)
+     */
+    _Atomic size_t size;
+};
+
+/**
+ * 여러 개의 잠금 힙큐로 이루어진 느슨한 우선순위 큐 (MultiQueue)
+ *
+ * 삽입은 임의의 힙큐 하나에, 삭제는 임의의 두 힙큐의 앞 요소 중 앞선 쪽에서 한다.
+ * 스레드들이 서로 다른 힙큐를 잡으므로 스레드 수에 따라 처리량이 늘어나지만,
+ * 꺼내는 순서는 대략적으로만 우선순위를 따른다. (엄격한 순서는 unds_locked_heap_queue_t)
+ */
+struct unds_multi_queue_t
+{
+    /**
+     * 힙큐들
+     */
+    struct __unds_multi_queue_lane_t* lanes;
+    /**
+     * 힙큐의 개수
+     */
+    size_t num_lanes;
+    /**
+     * 멀티큐 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 멀티큐 연산 시에 사용되는 요소 비교 함수
+     */
+    int (*comp)(const void* p, const void* q);
+};
+
+typedef struct unds_multi_queue_t unds_multi_queue_t;
+
+/**
+ * 힙큐의 개수는 동시에 사용할 스레드 수의 두 배 정도가 적당하다.
+ *
+ * @brief 새로운 멀티큐 생성
+ * @param of_size 멀티큐에 저장할 단일 요소의 크기
+ * @param comp 멀티큐 연산 시에 사용되는 요소 비교 함수
+ * @param num_lanes 힙큐의 개수 (0이면 온라인 CPU 수의 두 배, 최소 2)
+ * @return 동적으로 생성된 멀티큐의 주소
+ */
+unds_multi_queue_t* unds_multi_queue_create(size_t of_size, int (*comp)(const void* p, const void* q), size_t num_lanes);
+
+/**
+ * @brief 멀티큐 삭제
+ * @param ths 대상 멀티큐 포인터
+ */
+void unds_multi_queue_delete(unds_multi_queue_t* ths);
+
+/**
+ * 다른 스레드가 동시에 삽입, 삭제 중이면 호출한 시점의 근사값이다.
+ *
+ * @brief 멀티큐의 크기 반환
+ * @param ths 대상 멀티큐 포인터
+ * @return 멀티큐의 크기
+ */
+size_t unds_multi_queue_size(unds_multi_queue_t* ths);
+
+/**
+ * 다른 스레드가 동시에 삽입, 삭제 중이면 호출한 시점의 근사값이다.
+ *
+ * @brief 멀티큐가 비었는지 여부 반환
+ * @param ths 대상 멀티큐 포인터
+ * @return 멀티큐 빔 여부
+ */
+bool unds_multi_queue_empty(unds_multi_queue_t* ths);
+
+/**
+ * @brief 멀티큐에 요소 삽입
+ * @param ths 대상 멀티큐 포인터
+ * @param value 삽입할 값의 포인터
+ */
+void unds_multi_queue_push(unds_multi_queue_t* ths, void* value);
+
+/**
+ * @brief 멀티큐에서 앞선 요소 하나를 dest에 복사하고 삭제 시도
+ * @param ths 대상 멀티큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ * @return 삭제 여부 (모든 힙큐가 비어 있으면 false)
+ */
+bool unds_multi_queue_try_pop(unds_multi_queue_t* ths, void* dest);
+
+
+#endif
+
+/**
+ * 배열을 기반으로 구현된 가변 크기 스택
+ */
+struct unds_stack_t
+{
+    /**
+     * 실제 데이터를 저장할 공간에 대한 포인터
+     */
+    void* arr;
+    /**
+     * 스택의 한계 용량
+     */
+    size_t capacity;
+    /**
+     * 스택의 크기
+     */
+    size_t size;
+    /**
+     * 스택 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 구조체와 함께 할당된 내장 공간 또는 init에 전달된 공간 (없으면 NULL)
+     */
+    void* inline_arr;
+    /**
+     * 내장 공간의 용량 (용량이 이보다 작아지지 않으며, 이하일 때는 힙을 사용하지 않는다.)
+     */
+    size_t inline_capacity;
+};
+
+typedef struct unds_stack_t unds_stack_t;
+
+/**
+ * @brief 새로운 스택 생성
+ * @param of_size 스택에 저장할 단일 요소의 크기
+ * @return 동적으로 생성된 스택의 주소
+ */
+unds_stack_t* unds_stack_create(size_t of_size);
+
+/**
+ * @brief 배열로부터 새로운 스택 생성
+ * @param arr 스택으로 생성할 배열의 포인터
+ * @param size 스택으로 생성할 배열의 길이
+ * @param of_size 스택으로 생성할 배열의 단일 요소의 크기
+ * @return 동적으로 생성된 스택의 주소
+ */
+unds_stack_t* unds_stack_create_from_array(void* arr, size_t size, size_t of_size);
+
+/**
+ * @brief 기본값을 설정하여 새로운 스택 생성
+ * @param value 스택의 기본값으로 설정할 값의 포인터
+ * @param size 생성할 스택의 길이
+ * @param of_size 스택의 기본값으로 설정할 값의 크기
+ * @return 동적으로 생성된 스택의 주소
+ */
+unds_stack_t* unds_stack_create_from_value(void* value, size_t size, size_t of_size);
+
+/**
+ * 구조체 뒤에 capacity개의 요소를 담을 내장 공간을 붙여 한 번에 할당한다.
+ * 요소가 내장 공간에 들어가는 동안에는 힙을 더 사용하지 않으며, 넘치면 힙으로 옮긴다.
+ * 내장 공간의 용량은 2의 제곱수로 내림한다.
+ *
+ * @brief 내장 공간을 가진 새로운 스택 생성
+ * @param of_size 스택에 저장할 단일 요소의 크기
+ * @param capacity 내장 공간에 저장할 요소의 개수
+ * @return 동적으로 생성된 스택의 주소
+ */
+unds_stack_t* unds_stack_create_inline(size_t of_size, size_t capacity);
+
+/**
+ * ths와 storage는 호출한 쪽이 소유하므로, 지역 변수로 선언하면
+ * 요소가 storage에 들어가는 동안 힙을 전혀 사용하지 않는다.
+ * unds_stack_delete 대신 unds_stack_deinit으로 정리해야 한다.
+ *
+ * -> int 요소 16개까지는 힙을 사용하지 않는 스택.
+ *    int storage[16];
+ *    unds_stack_t stack;
+ *    unds_stack_init(&stack, sizeof(int), storage, 16);
+ *    ...
+ *    unds_stack_deinit(&stack);
+ *
+ * @brief 호출한 쪽의 공간을 내장 공간으로 사용하여 스택 초기화
+ * @param ths 초기화할 스택 포인터
+ * @param of_size 스택에 저장할 단일 요소의 크기
+ * @param storage 내장 공간으로 사용할 공간의 포인터 (NULL이면 힙만 사용)
+ * @param capacity storage에 저장할 수 있는 요소의 개수 (2의 제곱수로 내림)
+ */
+void unds_stack_init(unds_stack_t* ths, size_t of_size, void* storage, size_t capacity);
+
+/**
+ * @brief unds_stack_init으로 초기화한 스택이 사용한 힙 공간 해제
+ * @param ths 대상 스택 포인터
+ */
+void unds_stack_deinit(unds_stack_t* ths);
+
+/**
+ * @brief 스택 삭제
+ * @param ths 대상 스택 포인터
+ */
+void unds_stack_delete(unds_stack_t* ths);
+
+/**
+ * @brief 스택이 비었는지 여부 반환
+ * @param ths 대상 스택 포인터
+ * @return 스택 빔 여부
+ */
+bool unds_stack_empty(unds_stack_t* ths);
+
+/**
+ * @brief 스택에 새로운 요소 삽입
+ * @param ths 대상 스택 포인터
+ * @param value 삽입할 대상을 가리키는 포인터
+ */
+void unds_stack_push(unds_stack_t* ths, void* value);
+
+/**
+ * @brief 스택의 마지막 요소를 삭제
+ * @param ths 대상 스택 포인터
+ */
+void unds_stack_pop(unds_stack_t* ths);
+
+/**
+ * @brief 스택의 마지막 요소를 dest에 복사
+ * @param ths 대상 스택 포인터
+ * @param dest 요소를 복사할 목적지
+ */
+void unds_stack_top(unds_stack_t* ths, void* dest);
+
+/**
+ * @brief 스택 초기화
+ * @param ths 대상 스택 포인터
+ */
+void unds_stack_clear(unds_stack_t* ths);
+
+/**
+ * 이미 충분한 용량을 가지고 있다면 아무 것도 하지 않는다.
+ * 용량은 capacity개의 요소를 재할당 없이 삽입할 수 있는 2의 제곱수로 맞춘다.
+ *
+ * @brief 스택의 용량을 미리 확보
+ * @param ths 대상 스택 포인터
+ * @param capacity 확보할 요소의 개수
+ */
+void unds_stack_reserve(unds_stack_t* ths, size_t capacity);
+
+/**
+ * @brief 스택의 용량을 현재 크기에 맞게 감소
+ * @param ths 대상 스택 포인터
+ */
+void unds_stack_shrink_to_fit(unds_stack_t* ths);
+
+/**
+ * @brief 스택에 배열의 요소를 한 번에 삽입
+ * @param ths 대상 스택 포인터
+ * @param arr 삽입할 배열의 포인터
+ * @param n 삽입할 요소의 개수
+ */
+void unds_stack_push_n(unds_stack_t* ths, void* arr, size_t n);
+
+/**
+ * dest에는 삭제되는 요소가 스택에 삽입된 순서 그대로 복사된다.
+ * (unds_stack_push_n(dest, n)으로 다시 삽입하면 원래의 스택이 된다.)
+ * dest가 NULL이면 복사하지 않고 삭제만 한다.
+ *
+ * @brief 스택의 위쪽 n개의 요소를 dest에 복사하고 삭제
+ * @param ths 대상 스택 포인터
+ * @param dest 요소를 복사할 목적지
+ * @param n 삭제할 요소의 개수
+ */
+void unds_stack_pop_n(unds_stack_t* ths, void* dest, size_t n);
+
+#ifndef UNDS_TIMER_WHEEL_BITS
+/**
+ * 타이머 휠 한 단계의 칸의 개수의 로그 (한 단계는 2^UNDS_TIMER_WHEEL_BITS개의 칸으로 이루어진다.)
+ */
+#define UNDS_TIMER_WHEEL_BITS 6
+#endif
+
+#ifndef UNDS_TIMER_WHEEL_LEVELS
+/**
+ * 타이머 휠의 단계의 개수
+ * (2^(UNDS_TIMER_WHEEL_BITS * UNDS_TIMER_WHEEL_LEVELS)틱보다 먼 타이머는 마지막 단계를 여러 번 돈다.)
+ */
+#define UNDS_TIMER_WHEEL_LEVELS 4
+#endif
+
+/**
+ * *내부 상수
+ *
+ * 타이머 휠 한 단계의 칸의 개수
+ */
+#define __UNDS_TIMER_WHEEL_SLOTS ((size_t)1 << UNDS_TIMER_WHEEL_BITS)
+/**
+ * *내부 상수
+ *
+ * 타이머 휠에서 노드가 없음을 나타내는 인덱스
+ */
+#define __UNDS_TIMER_WHEEL_NIL SIZE_MAX
+/**
+ * *내부 상수
+ *
+ * 이미 처리한 틱에 만료되는 타이머를 모아 두는 칸 (모든 단계의 칸 뒤에 둔다.)
+ */
+#define __UNDS_TIMER_WHEEL_OVERDUE (UNDS_TIMER_WHEEL_LEVELS * __UNDS_TIMER_WHEEL_SLOTS)
+
+/**
+ * 타이머 휠에 등록된 타이머의 식별자
+ * (하위 32비트는 노드 인덱스, 상위 32비트는 세대이므로 취소되거나 만료된 식별자는 재사용된 노드와 구별된다.)
+ */
+typedef uint64_t unds_timer_id_t;
+
+/**
+ * *내부 자료형
+ *
+ * 타이머 휠의 노드 (노드 풀의 인덱스로 연결된다.)
+ */
+struct __unds_timer_node_t
+{
+    /**
+     * 만료 틱
+     */
+    uint64_t expires;
+    /**
+     * 같은 칸의 이전 노드
+     */
+    size_t prev;
+    /**
+     * 같은 칸의 다음 노드 (빈 노드이면 다음 빈 노드)
+     */
+    size_t next;
+    /**
+     * 노드가 들어 있는 칸 (빈 노드이면 __UNDS_TIMER_WHEEL_NIL)
+     */
+    size_t slot;
+    /**
+     * 노드가 재사용될 때마다 늘어나는 세대
+     */
+    uint32_t generation;
+};
+
+/**
+ * 계층형 타이머 휠
+ *
+ * 단계 l의 칸 하나는 2^(UNDS_TIMER_WHEEL_BITS * l)틱을 담당한다.
+ * 먼 타이머는 위 단계에 들어갔다가 시간이 흐르면 아래 단계로 옮겨지며(cascade),
+ * 0단계의 칸에 도달한 타이머는 그 칸의 틱에 한꺼번에 만료된다.
+ * 등록과 취소는 O(1)이며, 노드는 풀에서 재사용한다.
+ */
+struct unds_timer_wheel_t
+{
+    /**
+     * 각 칸의 첫 노드의 인덱스 (마지막 칸은 __UNDS_TIMER_WHEEL_OVERDUE)
+     */
+    size_t slots[UNDS_TIMER_WHEEL_LEVELS * __UNDS_TIMER_WHEEL_SLOTS + 1];
+    /**
+     * 각 단계에 들어 있는 노드의 개수 (마지막은 __UNDS_TIMER_WHEEL_OVERDUE 칸)
+     */
+    size_t level_size[UNDS_TIMER_WHEEL_LEVELS + 1];
+    /**
+     * 노드 풀
+     */
+    struct __unds_timer_node_t* nodes;
+    /**
+     * 노드마다 저장된 값
+     */
+    void* values;
+    /**
+     * 노드 풀의 용량
+     */
+    size_t capacity;
+    /**
+     * 등록된 타이머의 개수
+     */
+    size_t size;
+    /**
+     * 첫 빈 노드의 인덱스
+     */
+    size_t free_head;
+    /**
+     * 타이머에 저장할 단일 값의 크기
+     */
+    size_t of_size;
+    /**
+     * 틱 하나의 시간 (시간의 단위는 호출하는 쪽이 정한다.)
+     */
+    uint64_t tick;
+    /**
+     * 다음에 처리할 틱
+     */
+    uint64_t current;
+};
+
+typedef struct unds_timer_wheel_t unds_timer_wheel_t;
+
+/**
+ * @brief 새로운 타이머 휠 생성
+ * @param of_size 타이머에 저장할 단일 값의 크기
+ * @param tick 틱 하나의 시간 (0보다 커야 한다.)
+ * @param now 현재 시각
+ * @return 동적으로 생성된 타이머 휠의 주소
+ */
+unds_timer_wheel_t* unds_timer_wheel_create(size_t of_size, uint64_t tick, uint64_t now);
+
+/**
+ * @brief 타이머 휠 삭제
+ * @param ths 대상 타이머 휠 포인터
+ */
+void unds_timer_wheel_delete(unds_timer_wheel_t* ths);
+
+/**
+ * @brief 타이머 휠이 비었는지 여부 반환
+ * @param ths 대상 타이머 휠 포인터
+ * @return 타이머 휠 빔 여부
+ */
+bool unds_timer_wheel_empty(unds_timer_wheel_t* ths);
+
+/**
+ * @brief 타이머 휠에 등록된 타이머의 개수 반환
+ * @param ths 대상 타이머 휠 포인터
+ * @return 타이머의 개수
+ */
+size_t unds_timer_wheel_size(unds_timer_wheel_t* ths);
+
+/**
+ * 만료 시각은 틱 단위로 올림되므로 타이머는 deadline보다 일찍 만료되지 않는다.
+ * 이미 처리한 틱보다 이른 시각을 지정하면 다음 unds_timer_wheel_advance에서 바로 만료된다.
+ *
+ * @brief 타이머 등록
+ * @param ths 대상 타이머 휠 포인터
+ * @param deadline 만료 시각
+ * @param value 만료될 때 돌려받을 값의 포인터
+ * @return 타이머의 식별자
+ */
+unds_timer_id_t unds_timer_wheel_schedule(unds_timer_wheel_t* ths, uint64_t deadline, void* value);
+
+/**
+ * 이미 만료되었거나 취소된 식별자는 무시한다.
+ *
+ * @brief 타이머 취소
+ * @param ths 대상 타이머 휠 포인터
+ * @param id 취소할 타이머의 식별자
+ * @param dest 타이머의 값을 복사할 목적지 (NULL이면 복사하지 않는다.)
+ * @return 취소 여부 (등록되어 있지 않은 타이머이면 false)
+ */
+bool unds_timer_wheel_cancel(unds_timer_wheel_t* ths, unds_timer_id_t id, void* dest);
+
+/**
+ * @brief 타이머가 아직 등록되어 있는지 여부 반환
+ * @param ths 대상 타이머 휠 포인터
+ * @param id 확인할 타이머의 식별자
+ * @return 등록 여부
+ */
+bool unds_timer_wheel_pending(unds_timer_wheel_t* ths, unds_timer_id_t id);
+
+/**
+ * 만료된 타이머의 값은 틱 순서대로 expired에 추가된다. (같은 틱 안의 순서는 정해져 있지 않다.)
+ * 타이머가 없는 구간은 건너뛰므로 오랜만에 호출해도 된다.
+ *
+ * @brief 현재 시각까지 시간을 진행하고 만료된 타이머를 꺼냄
+ * @param ths 대상 타이머 휠 포인터
+ * @param now 현재 시각
+ * @param expired 만료된 타이머의 값을 추가할 리스트 (요소의 크기가 같아야 하며, NULL이면 버린다.)
+ * @return 만료된 타이머의 개수
+ */
+size_t unds_timer_wheel_advance(unds_timer_wheel_t* ths, uint64_t now, unds_list_t* expired);
+
+/**
+ * @brief 타이머 휠의 모든 타이머 삭제
+ * @param ths 대상 타이머 휠 포인터
+ */
+void unds_timer_wheel_clear(unds_timer_wheel_t* ths);
+
+#ifdef UNDS_IMPLEMENTATION
+
+/**
+ * *내부 자료형
+ *
+ * malloc과 같이 모든 기본 자료형에 맞춰 정렬하기 위한 공용체
+ * (max_align_t는 C11부터 있으므로 C99에서도 쓸 수 있도록 직접 정의한다.)
+ */
+union __unds_max_align_t
+{
+    long double ld;
+    long long ll;
+    double d;
+    void* ptr;
+    void (*func)(void);
+};
+
+#ifdef UNDS_USE_MMAP
+
+/**
+ * *내부 구조체
+ *
+ * 컨테이너 저장 공간의 앞에 위치하는 헤더
+ */
+struct __unds_storage_header_t
+{
+    /**
+     * 저장 공간의 크기 (헤더 제외)
+     */
+    size_t size;
+    /**
+     * 매핑된 영역의 크기 (힙에 할당되었으면 0)
+     */
+    size_t mapped;
+    /**
+     * MAP_HUGETLB로 매핑되었는지 여부
+     */
+    size_t huge;
+};
+
+/**
+ * *내부 자료형
+ *
+ * 저장 공간의 앞에서 헤더가 차지하는 공간
+ * 헤더 뒤의 저장 공간이 malloc과 같이 정렬되도록 헤더를 정렬 단위의 배수로 늘린다.
+ */
+union __unds_storage_header_slot_t
+{
+    struct __unds_storage_header_t header;
+    union __unds_max_align_t align;
+};
+
+/**
+ * *내부 함수
+ *
+ * @brief 저장 공간을 새로 매핑
+ * @param size 필요한 크기 (헤더 포함)
+ * @return 매핑된 영역의 헤더 (실패 시 NULL)
+ */
+struct __unds_storage_header_t* __unds_storage_map(size_t size)
+{
+    struct __unds_storage_header_t* header = NULL;
+
+#ifndef MAP_ANONYMOUS
+    (void)size;
+    (void)header;
+    return NULL;
+#else
+
+#if defined(UNDS_MMAP_HUGETLB) && defined(MAP_HUGETLB)
+    size_t huge_length = (size + UNDS_MMAP_HUGE_PAGE_SIZE - 1) / UNDS_MMAP_HUGE_PAGE_SIZE * UNDS_MMAP_HUGE_PAGE_SIZE;
+
+    void* huge_buffer = mmap(NULL, huge_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (huge_buffer != MAP_FAILED)
+    {
+        header = (struct __unds_storage_header_t*)huge_buffer;
+        header->mapped = huge_length;
+        header->huge = 1;
+
+        return header;
+    }
+#endif
+
+    void* buffer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer == MAP_FAILED)
+        return NULL;
+
+#ifdef MADV_HUGEPAGE
+    madvise(buffer, size, MADV_HUGEPAGE);
+#endif
+
+    header = (struct __unds_storage_header_t*)buffer;
+    header->mapped = size;
+    header->huge = 0;
+
+    return header;
+#endif
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 저장 공간의 사용량을 메모리 추적에 반영
+ * @param added 새로 사용하는 크기
+ * @param removed 더 이상 사용하지 않는 크기
+ */
+void __unds_storage_track(size_t added, size_t removed)
+{
+#if defined(UNDS_TRACK_MEM) || defined(UNDS_TRACE_MEM)
+    __unds_memory_track(added, removed);
+#else
+    (void)added;
+    (void)removed;
+#endif
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 컨테이너 저장 공간 할당
+ * @param size 할당 받을 메모리의 크기
+ * @return 동적할당된 포인터
+ */
+void* __unds_storage_alloc(size_t size)
+{
+    size_t total = size + sizeof(union __unds_storage_header_slot_t);
+    struct __unds_storage_header_t* header = NULL;
+
+    if (size >= UNDS_MMAP_THRESHOLD)
+    {
+        header = __unds_storage_map(total);
+        if (header != NULL)
+            __unds_storage_track(header->mapped, 0);
+    }
+
+    if (header == NULL)
+    {
+        header = (struct __unds_storage_header_t*)unds_malloc(total);
+        if (header == NULL)
+            return NULL;
+
+        header->mapped = 0;
+        header->huge = 0;
+    }
+
+    header->size = size;
+
+    return (char*)header + sizeof(union __unds_storage_header_slot_t);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 컨테이너 저장 공간 해제
+ * @param ptr 해제할 포인터
+ */
+void __unds_storage_free(void* ptr)
+{
+    if (ptr == NULL)
+        return;
+
+    struct __unds_storage_header_t* header = (struct __unds_storage_header_t*)((char*)ptr - sizeof(union __unds_storage_header_slot_t));
+
+    if (header->mapped == 0)
+    {
+        unds_free(header);
+        return;
+    }
+
+    __unds_storage_track(0, header->mapped);
+    munmap(header, header->mapped);
+}
+
+/**
+ * *내부 함수
+ *
+ * 매핑된 공간끼리는 mremap으로 크기를 바꿔 데이터를 복사하지 않는다.
+ *
+ * @brief 컨테이너 저장 공간 재할당
+ * @param ptr 재할당 받을 포인터
+ * @param size 할당 받을 메모리의 크기
+ * @return 동적할당된 포인터
+ */
+void* __unds_storage_realloc(void* ptr, size_t size)
+{
+    if (ptr == NULL)
+        return __unds_storage_alloc(size);
+
+    struct __unds_storage_header_t* header = (struct __unds_storage_header_t*)((char*)ptr - sizeof(union __unds_storage_header_slot_t));
+    size_t total = size + sizeof(union __unds_storage_header_slot_t);
+
+    if (header->mapped == 0 && size < UNDS_MMAP_THRESHOLD)
+    {
+        header = (struct __unds_storage_header_t*)unds_realloc(header, total);
+        if (header == NULL)
+            return NULL;
+
+        header->size = size;
+
+        return (char*)header + sizeof(union __unds_storage_header_slot_t);
+    }
+
+#ifdef MREMAP_MAYMOVE
+    if (header->mapped != 0 && size >= UNDS_MMAP_THRESHOLD)
+    {
+        size_t old_length = header->mapped;
+        size_t length = total;
+        if (header->huge)
+            length = (total + UNDS_MMAP_HUGE_PAGE_SIZE - 1) / UNDS_MMAP_HUGE_PAGE_SIZE * UNDS_MMAP_HUGE_PAGE_SIZE;
+
+        void* buffer = mremap(header, old_length, length, MREMAP_MAYMOVE);
+        if (buffer != MAP_FAILED)
+        {
+            header = (struct __unds_storage_header_t*)buffer;
+            header->size = size;
+            header->mapped = length;
+
+#ifdef MADV_HUGEPAGE
+            if (!header->huge)
+                madvise(buffer, length, MADV_HUGEPAGE);
+#endif
+
+            __unds_storage_track(length, old_length);
+            return (char*)header + sizeof(union __unds_storage_header_slot_t);
+        }
+    }
+#endif
+
+    // 힙과 매핑 사이를 오가는 경우에는 새 공간으로 복사한다.
+    void* new_ptr = __unds_storage_alloc(size);
+    if (new_ptr == NULL)
+        return NULL;
+
+    memcpy(new_ptr, ptr, header->size < size ? header->size : size);
+    __unds_storage_free(ptr);
+
+    return new_ptr;
+}
+
+#else
+
+#define __unds_storage_alloc unds_malloc
+#define __unds_storage_realloc unds_realloc
+#define __unds_storage_free unds_free
+
+#endif
+
+/**
+ * *내부 함수
+ *
+ * 내장 공간을 가진 컨테이너는 용량이 inline_capacity 이하이면 내장 공간을, 넘으면 힙을 사용한다.
+ * 내장 공간과 힙 사이를 옮길 때는 realloc과 같이 앞쪽 min(old_capacity, capacity)개의 요소를 복사한다.
+ *
+ * @brief 내장 공간을 고려하여 컨테이너 저장 공간 크기 변경
+ * @param arr 현재 저장 공간
+ * @param inline_arr 내장 공간 (없으면 NULL)
+ * @param inline_capacity 내장 공간의 용량
+ * @param old_capacity 현재 용량
+ * @param capacity 변경할 용량 (inline_capacity 이상)
+ * @param of_size 단일 요소의 크기
+ * @return 변경된 저장 공간 (실패 시 NULL)
+ */
+void* __unds_inline_realloc(void* arr, void* inline_arr, size_t inline_capacity, size_t old_capacity, size_t capacity, size_t of_size)
+{
+    size_t used = (old_capacity < capacity ? old_capacity : capacity) * of_size;
+
+    if (arr != inline_arr)
+    {
+        if (capacity > inline_capacity)
+            return __unds_storage_realloc(arr, capacity * of_size);
+
+        memcpy(inline_arr, arr, used);
+        __unds_storage_free(arr);
+        return inline_arr;
+    }
+
+    if (capacity <= inline_capacity)
+        return arr;
+
+    void* new_arr = __unds_storage_alloc(capacity * of_size);
+    if (new_arr != NULL)
+        memcpy(new_arr, arr, used);
+
+    return new_arr;
+}
+
+/**
+ * *내부 함수
+ *
+ * 두 배로 늘리다 size_t를 넘치거나 요소의 총 크기가 size_t를 넘으면 중단한다.
+ *
+ * @brief capacity 이상이 될 때까지 현재 용량을 두 배씩 늘린 용량 반환
+ * @param current 현재 용량
+ * @param capacity 확보할 요소의 개수
+ * @param of_size 단일 요소의 크기
+ * @param func 오류 메시지에 표시할 함수 이름
+ * @return 늘린 용량
+ */
+size_t __unds_grow_capacity(size_t current, size_t capacity, size_t of_size, const char* func)
+{
+    size_t correct_capacity = current > 0 ? current : 1;
+
+    while (correct_capacity < capacity)
+    {
+        if (correct_capacity > SIZE_MAX / 2)
+        {
+            fprintf(stderr, "stderr: Requested capacity is too large in %s().\n", func);
+            abort();
+        }
+        correct_capacity *= 2;
+    }
+
+    if (of_size != 0 && correct_capacity > SIZE_MAX / of_size)
+    {
+        fprintf(stderr, "stderr: Requested capacity is too large in %s().\n", func);
+        abort();
+    }
+
+    return correct_capacity;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 내장 공간의 용량을 2의 제곱수로 내림
+ * @param capacity 내장 공간에 들어갈 수 있는 요소의 개수
+ * @return 2의 제곱수로 내린 용량 (capacity가 0이면 0)
+ */
+size_t __unds_inline_capacity(size_t capacity)
+{
+    size_t correct_capacity = 1;
+
+    if (capacity == 0)
+        return 0;
+
+    while (correct_capacity <= capacity / 2)
+        correct_capacity *= 2;
+
+    return correct_capacity;
+}
+
+/**
+ * *내부 매크로
+ *
+ * 구조체 뒤에 내장 공간을 붙여 할당할 때 내장 공간이 시작하는 위치 (16바이트 정렬)
+ */
+#define __UNDS_INLINE_OFFSET(type) ((sizeof(type) + 15) & ~(size_t)15)
+
+unds_pair_t* unds_pair_create(size_t of_size_first, size_t of_size_second)
+{
+    if (of_size_first == 0 || of_size_second == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of pair cannot be zero.\n");
+        abort();
+    }
+
+    unds_pair_t* ths = (unds_pair_t*)unds_malloc(sizeof(unds_pair_t));
+
+    ths->first = unds_malloc(of_size_first);
+    ths->second = unds_malloc(of_size_second);
+    if (ths->first == NULL || ths->second == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for pair in pair_create().\n");
+        abort();
+    }
+
+    ths->of_size_first = of_size_first;
+    ths->of_size_second = of_size_second;
+
+    return ths;
+}
+
+unds_pair_t* unds_pair_make(void* first, size_t of_size_first, void* second, size_t of_size_second)
+{
+    if (first == NULL || second == NULL)
+    {
+        fprintf(stderr, "stderr: Pair element cannot be NULL.\n");
+        abort();
+    }
+
+    unds_pair_t* ths = unds_pair_create(of_size_first, of_size_second);
+
+    memcpy(ths->first, first, ths->of_size_first);
+    memcpy(ths->second, second, ths->of_size_second);
+
+    return ths;
+}
+
+void unds_pair_delete(unds_pair_t* ths)
+{
+    unds_free(ths->first);
+    unds_free(ths->second);
+    unds_free(ths);
+}
+
+void unds_pair_get_first(unds_pair_t* ths, void* dest)
+{
+    memcpy(dest, ths->first, ths->of_size_first);
+}
+
+void unds_pair_get_second(unds_pair_t* ths, void* dest)
+{
+    memcpy(dest, ths->second, ths->of_size_second);
+}
+
+void unds_pair_set_first(unds_pair_t* ths, void* value)
+{
+    memcpy(ths->first, value, ths->of_size_first);
+}
+
+void unds_pair_set_second(unds_pair_t* ths, void* value)
+{
+    memcpy(ths->second, value, ths->of_size_second);
+}
+
+/**
+ * *내부 자료형
+ *
+ * 작은 요소 하나를 담는 스택 공간
+ * 비교 함수에 넘겨지므로 malloc과 같이 정렬한다.
+ */
+union __unds_sort_small_temp_t
+{
+    /**
+     * 정렬을 맞추기 위한 멤버
+     */
+    union __unds_max_align_t align;
+    /**
+     * 요소를 담을 공간
+     */
+    char buffer[64];
+};
+
+/**
+ * *내부 구조체
+ *
+ * 정렬 중에 공통으로 사용되는 값의 모음
+ */
+struct __unds_sort_context_t
+{
+    /**
+     * 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 정렬 기준을 정의하는 함수
+     */
+    int (*comp)(const void*, const void*);
+    /**
+     * 피벗 등 요소 하나를 임시로 담을 공간
+     */
+    char* temp;
+};
+
+/**
+ * *내부 함수
+ *
+ * 요소를 워드 단위로 나누어 교환하므로 바이트 단위 교환보다 빠르다.
+ *
+ * @brief 두 요소 교환
+ * @param p 교환할 요소의 포인터
+ * @param q 교환할 요소의 포인터
+ * @param of_size 단일 요소의 크기
+ */
+void __unds_sort_swap(char* p, char* q, size_t of_size)
+{
+    size_t word;
+
+    while (of_size >= sizeof(size_t))
+    {
+        memcpy(&word, p, sizeof(size_t));
+        memcpy(p, q, sizeof(size_t));
+        memcpy(q, &word, sizeof(size_t));
+
+        p += sizeof(size_t);
+        q += sizeof(size_t);
+        of_size -= sizeof(size_t);
+    }
+
+    if (of_size >= sizeof(uint32_t))
+    {
+        uint32_t half_word;
+
+        memcpy(&half_word, p, sizeof(uint32_t));
+        memcpy(p, q, sizeof(uint32_t));
+        memcpy(q, &half_word, sizeof(uint32_t));
+
+        p += sizeof(uint32_t);
+        q += sizeof(uint32_t);
+        of_size -= sizeof(uint32_t);
+    }
+
+    while (of_size > 0)
+    {
+        char byte = *p;
+        *p++ = *q;
+        *q++ = byte;
+        of_size--;
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 세 요소 정렬
+ * @param ctx 정렬 문맥
+ * @param a 정렬할 첫 번째 요소
+ * @param b 정렬할 두 번째 요소
+ * @param c 정렬할 세 번째 요소
+ */
+void __unds_sort_sort3(struct __unds_sort_context_t* ctx, char* a, char* b, char* c)
+{
+    if (ctx->comp(b, a) < 0)
+        __unds_sort_swap(a, b, ctx->of_size);
+    if (ctx->comp(c, b) < 0)
+        __unds_sort_swap(b, c, ctx->of_size);
+    if (ctx->comp(b, a) < 0)
+        __unds_sort_swap(a, b, ctx->of_size);
+}
+
+/**
+ * *내부 함수
+ *
+ * partial이 참이면 옮긴 요소가 __UNDS_SORT_PARTIAL_INSERTION_LIMIT개를 넘을 때 중단한다.
+ *
+ * @brief [begin, end) 구간을 삽입 정렬
+ * @param ctx 정렬 문맥
+ * @param begin 구간의 시작
+ * @param end 구간의 끝
+ * @param partial 중단 가능 여부
+ * @return 정렬을 마쳤는지 여부
+ */
+bool __unds_sort_insertion(struct __unds_sort_context_t* ctx, char* begin, char* end, bool partial)
+{
+    size_t of_size = ctx->of_size;
+    size_t moved = 0;
+
+    if (begin == end)
+        return true;
+
+    for (char* cur = begin + of_size; cur != end; cur += of_size)
+    {
+        if (ctx->comp(cur, cur - of_size) >= 0)
+            continue;
+
+        // 들어갈 위치를 찾은 뒤 사이의 요소를 한 번에 민다.
+        char* sift = cur;
+        memcpy(ctx->temp, cur, of_size);
+        do
+            sift -= of_size;
+        while (sift != begin && ctx->comp(ctx->temp, sift - of_size) < 0);
+
+        memmove(sift + of_size, sift, (size_t)(cur - sift));
+        memcpy(sift, ctx->temp, of_size);
+
+        moved += (size_t)(cur - sift) / of_size;
+        if (partial && moved > __UNDS_SORT_PARTIAL_INSERTION_LIMIT)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 힙 정렬의 요소를 아래로 내림
+ * @param ctx 정렬 문맥
+ * @param base 힙의 시작
+ * @param index 내릴 요소의 인덱스
+ * @param size 힙의 크기
+ */
+void __unds_sort_sift_down(struct __unds_sort_context_t* ctx, char* base, size_t index, size_t size)
+{
+    size_t of_size = ctx->of_size;
+    size_t child;
+
+    while ((child = 2 * index + 1) < size)
+    {
+        if (child + 1 < size && ctx->comp(base + child * of_size, base + (child + 1) * of_size) < 0)
+            child++;
+        if (ctx->comp(base + index * of_size, base + child * of_size) >= 0)
+            break;
+
+        __unds_sort_swap(base + index * of_size, base + child * of_size, of_size);
+        index = child;
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief [begin, end) 구간을 힙 정렬
+ * @param ctx 정렬 문맥
+ * @param begin 구간의 시작
+ * @param end 구간의 끝
+ */
+void __unds_sort_heap(struct __unds_sort_context_t* ctx, char* begin, char* end)
+{
+    size_t size = (size_t)(end - begin) / ctx->of_size;
+
+    for (size_t i = size / 2; i-- > 0;)
+        __unds_sort_sift_down(ctx, begin, i, size);
+    for (size_t i = size; i-- > 1;)
+    {
+        __unds_sort_swap(begin, begin + i * ctx->of_size, ctx->of_size);
+        __unds_sort_sift_down(ctx, begin, 0, i);
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * 피벗보다 작은 요소를 왼쪽으로, 크거나 같은 요소를 오른쪽으로 분할한다.
+ *
+ * @brief 첫 요소를 피벗으로 [begin, end) 구간 분할
+ * @param ctx 정렬 문맥
+ * @param begin 구간의 시작
+ * @param end 구간의 끝
+ * @param already 교환 없이 이미 분할되어 있었는지 여부
+ * @return 피벗의 최종 위치
+ */
+char* __unds_sort_partition_right(struct __unds_sort_context_t* ctx, char* begin, char* end, bool* already)
+{
+    size_t of_size = ctx->of_size;
+    char* pivot = ctx->temp;
+    char* first = begin;
+    char* last = end;
+
+    memcpy(pivot, begin, of_size);
+
+    do
+        first += of_size;
+    while (ctx->comp(first, pivot) < 0);
+
+    if (first - of_size == begin)
+        while (first < last && ctx->comp(last -= of_size, pivot) >= 0)
+            ;
+    else
+        do
+            last -= of_size;
+        while (ctx->comp(last, pivot) >= 0);
+
+    *already = first >= last;
+
+    while (first < last)
+    {
+        __unds_sort_swap(first, last, of_size);
+        do
+            first += of_size;
+        while (ctx->comp(first, pivot) < 0);
+        do
+            last -= of_size;
+        while (ctx->comp(last, pivot) >= 0);
+    }
+
+    char* pivot_pos = first - of_size;
+    memmove(begin, pivot_pos, of_size);
+    memcpy(pivot_pos, pivot, of_size);
+
+    return pivot_pos;
+}
+
+/**
+ * *내부 함수
+ *
+ * 피벗과 같은 요소가 많을 때 사용하며, 피벗보다 작거나 같은 요소를 왼쪽으로 모은다.
+ *
+ * @brief 첫 요소를 피벗으로 [begin, end) 구간 분할
+ * @param ctx 정렬 문맥
+ * @param begin 구간의 시작
+ * @param end 구간의 끝
+ * @return 피벗의 최종 위치
+ */
+char* __unds_sort_partition_left(struct __unds_sort_context_t* ctx, char* begin, char* end)
+{
+    size_t of_size = ctx->of_size;
+    char* pivot = ctx->temp;
+    char* first = begin;
+    char* last = end;
+
+    memcpy(pivot, begin, of_size);
+
+    do
+        last -= of_size;
+    while (ctx->comp(pivot, last) < 0);
+
+    if (last + of_size == end)
+        while (first < last && ctx->comp(pivot, first += of_size) >= 0)
+            ;
+    else
+        do
+            first += of_size;
+        while (ctx->comp(pivot, first) >= 0);
+
+    while (first < last)
+    {
+        __unds_sort_swap(first, last, of_size);
+        do
+            last -= of_size;
+        while (ctx->comp(pivot, last) < 0);
+        do
+            first += of_size;
+        while (ctx->comp(pivot, first) >= 0);
+    }
+
+    memmove(begin, last, of_size);
+    memcpy(last, pivot, of_size);
+
+    return last;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief [begin, end) 구간을 pdqsort로 정렬
+ * @param ctx 정렬 문맥
+ * @param begin 구간의 시작
+ * @param end 구간의 끝
+ * @param bad_allowed 힙 정렬로 전환하기 전까지 허용되는 불균형 분할의 횟수
+ * @param leftmost 배열의 가장 왼쪽 구간인지 여부
+ */
+void __unds_sort_loop(struct __unds_sort_context_t* ctx, char* begin, char* end, int bad_allowed, bool leftmost)
+{
+    size_t of_size = ctx->of_size;
+
+    while (true)
+    {
+        size_t size = (size_t)(end - begin) / of_size;
+        if (size < __UNDS_SORT_INSERTION_THRESHOLD)
+        {
+            __unds_sort_insertion(ctx, begin, end, false);
+            return;
+        }
+
+        size_t s2 = size / 2;
+        if (size > __UNDS_SORT_NINTHER_THRESHOLD)
+        {
+            __unds_sort_sort3(ctx, begin, begin + s2 * of_size, end - of_size);
+            __unds_sort_sort3(ctx, begin + of_size, begin + (s2 - 1) * of_size, end - 2 * of_size);
+            __unds_sort_sort3(ctx, begin + 2 * of_size, begin + (s2 + 1) * of_size, end - 3 * of_size);
+            __unds_sort_sort3(ctx, begin + (s2 - 1) * of_size, begin + s2 * of_size, begin + (s2 + 1) * of_size);
+            __unds_sort_swap(begin, begin + s2 * of_size, of_size);
+        }
+        else
+            __unds_sort_sort3(ctx, begin + s2 * of_size, begin, end - of_size);
+
+        // 왼쪽 구간의 마지막 요소가 피벗과 같다면 피벗과 같은 요소를 한 번에 건너뛴다.
+        if (!leftmost && ctx->comp(begin - of_size, begin) >= 0)
+        {
+            begin = __unds_sort_partition_left(ctx, begin, end) + of_size;
+            continue;
+        }
+
+        bool already;
+        char* pivot_pos = __unds_sort_partition_right(ctx, begin, end, &already);
+        size_t l_size = (size_t)(pivot_pos - begin) / of_size;
+        size_t r_size = (size_t)(end - pivot_pos) / of_size - 1;
+
+        if (l_size < size / 8 || r_size < size / 8)
+        {
+            if (--bad_allowed == 0)
+            {
+                __unds_sort_heap(ctx, begin, end);
+                return;
+            }
+
+            // 입력의 패턴을 깨뜨리기 위해 일부 요소를 섞는다.
+            if (l_size >= __UNDS_SORT_INSERTION_THRESHOLD)
+            {
+                __unds_sort_swap(begin, begin + l_size / 4 * of_size, of_size);
+                __unds_sort_swap(pivot_pos - of_size, pivot_pos - l_size / 4 * of_size, of_size);
+            }
+            if (r_size >= __UNDS_SORT_INSERTION_THRESHOLD)
+            {
+                __unds_sort_swap(pivot_pos + of_size, pivot_pos + (1 + r_size / 4) * of_size, of_size);
+                __unds_sort_swap(end - of_size, end - r_size / 4 * of_size, of_size);
+            }
+        }
+        else if (already && __unds_sort_insertion(ctx, begin, pivot_pos, true) && __unds_sort_insertion(ctx, pivot_pos + of_size, end, true))
+            return;
+
+        __unds_sort_loop(ctx, begin, pivot_pos, bad_allowed, leftmost);
+        begin = pivot_pos + of_size;
+        leftmost = false;
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 임시 공간을 넘겨받아 배열 정렬
+ * @param arr 정렬할 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수
+ * @param temp 요소 하나를 담을 수 있는 임시 공간
+ */
+void __unds_sort_with_temp(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), char* temp)
+{
+    if (size < 2)
+        return;
+
+    struct __unds_sort_context_t ctx;
+
+    ctx.of_size = of_size;
+    ctx.comp = comp;
+    ctx.temp = temp;
+
+    int bad_allowed = 0;
+    while ((size >> bad_allowed) > 1)
+        bad_allowed++;
+
+    __unds_sort_loop(&ctx, (char*)arr, (char*)arr + size * of_size, bad_allowed, true);
+}
+
+void unds_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*))
+{
+    if (size < 2)
+        return;
+
+    union __unds_sort_small_temp_t small_temp;
+    char* temp = of_size <= sizeof(small_temp.buffer) ? small_temp.buffer : (char*)unds_malloc(of_size);
+    if (temp == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for sort in unds_sort().\n");
+        abort();
+    }
+
+    __unds_sort_with_temp(arr, size, of_size, comp, temp);
+
+    if (temp != small_temp.buffer)
+        unds_free(temp);
+}
+
+/**
+ * *내부 함수
+ *
+ * 같은 요소는 a의 요소를 먼저 내보내므로 안정적이다.
+ *
+ * @brief 정렬된 두 배열을 dest에 병합
+ * @param a 첫 번째 배열의 포인터
+ * @param na 첫 번째 배열의 길이
+ * @param b 두 번째 배열의 포인터
+ * @param nb 두 번째 배열의 길이
+ * @param dest 병합된 결과를 저장할 공간
+ * @param of_size 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수
+ */
+void __unds_merge(const char* a, size_t na, const char* b, size_t nb, char* dest, size_t of_size, int (*comp)(const void*, const void*))
+{
+    const char* a_end = a + na * of_size;
+    const char* b_end = b + nb * of_size;
+
+    while (a != a_end && b != b_end)
+    {
+        if (comp(b, a) < 0)
+        {
+            memcpy(dest, b, of_size);
+            b += of_size;
+        }
+        else
+        {
+            memcpy(dest, a, of_size);
+            a += of_size;
+        }
+        dest += of_size;
+    }
+
+    memcpy(dest, a, (size_t)(a_end - a));
+    dest += a_end - a;
+    memcpy(dest, b, (size_t)(b_end - b));
+}
+
+/**
+ * *내부 함수
+ *
+ * 병합 결과의 앞쪽 diag개의 요소 중 a에서 온 요소의 개수를 이분 탐색으로 구한다. (merge path)
+ *
+ * @brief 두 배열의 병합을 나눌 위치 계산
+ * @param a 첫 번째 배열의 포인터
+ * @param na 첫 번째 배열의 길이
+ * @param b 두 번째 배열의 포인터
+ * @param nb 두 번째 배열의 길이
+ * @param diag 병합 결과에서 나눌 위치
+ * @param of_size 단일 요소의 크기
+ * @param comp 정렬 기준을 정의하는 함수
+ * @return a에서 온 요소의 개수
+ */
+size_t __unds_merge_split(const char* a, size_t na, const char* b, size_t nb, size_t diag, size_t of_size, int (*comp)(const void*, const void*))
+{
+    size_t lo = diag > nb ? diag - nb : 0;
+    size_t hi = diag < na ? diag : na;
+
+    while (lo < hi)
+    {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = diag - i;
+
+        if (comp(a + i * of_size, b + (j - 1) * of_size) <= 0)
+            lo = i + 1;
+        else
+            hi = i;
+    }
+
+    return lo;
+}
+
+/**
+ * *내부 구조체
+ *
+ * 안정 정렬의 상태
+ */
+struct __unds_stable_sort_t
+{
+    char* arr;
+    size_t of_size;
+    int (*comp)(const void*, const void*);
+    /**
+     * 병합에 사용할 작업 공간 (첫 요소는 삽입 정렬의 임시 공간으로도 사용)
+     */
+    char* buffer;
+    size_t run_base[__UNDS_STABLE_SORT_MAX_RUNS];
+    size_t run_size[__UNDS_STABLE_SORT_MAX_RUNS];
+    size_t num_runs;
+};
+
+/**
+ * *내부 함수
+ *
+ * @brief 구간의 최소 길이 계산 (n / minrun이 2의 거듭제곱에 가깝도록)
+ * @param n 배열의 길이
+ * @return 구간의 최소 길이
+ */
+size_t __unds_stable_sort_minrun(size_t n)
+{
+    size_t r = 0;
+
+    while (n >= 64)
+    {
+        r |= n & 1;
+        n >>= 1;
+    }
+
+    return n + r;
+}
+
+/**
+ * *내부 함수
+ *
+ * 엄격한 내림차순 구간이면 뒤집어서 오름차순으로 만든다. (같은 요소가 없으므로 안정성이 유지된다.)
+ *
+ * @brief begin부터 시작하는 정렬된 구간의 길이 계산
+ * @param ctx 안정 정렬 상태
+ * @param begin 구간의 시작 위치
+ * @param end 배열의 끝 위치
+ * @return 구간의 길이
+ */
+size_t __unds_stable_sort_count_run(struct __unds_stable_sort_t* ctx, size_t begin, size_t end)
+{
+    size_t of_size = ctx->of_size;
+    char* arr = ctx->arr;
+    size_t i = begin + 1;
+
+    if (i == end)
+        return 1;
+
+    if (ctx->comp(arr + i * of_size, arr + (i - 1) * of_size) < 0)
+    {
+        while (i + 1 < end && ctx->comp(arr + (i + 1) * of_size, arr + i * of_size) < 0)
+            i++;
+
+        for (size_t lo = begin, hi = i; lo < hi; lo++, hi--)
+            __unds_sort_swap(arr + lo * of_size, arr + hi * of_size, of_size);
+    }
+    else
+    {
+        while (i + 1 < end && ctx->comp(arr + (i + 1) * of_size, arr + i * of_size) >= 0)
+            i++;
+    }
+
+    return i + 1 - begin;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 앞쪽 sorted개가 정렬된 구간을 이진 삽입 정렬로 정렬
+ * @param ctx 안정 정렬 상태
+ * @param begin 구간의 시작 위치
+ * @param end 구간의 끝 위치
+ * @param sorted 이미 정렬된 앞쪽 요소의 개수
+ */
+void __unds_stable_sort_insertion(struct __unds_stable_sort_t* ctx, size_t begin, size_t end, size_t sorted)
+{
+    size_t of_size = ctx->of_size;
+    char* arr = ctx->arr;
+    char* temp = ctx->buffer;
+
+    for (size_t i = begin + sorted; i < end; i++)
+    {
+        char* pivot = arr + i * of_size;
+        size_t lo = begin;
+        size_t hi = i;
+
+        // 같은 요소의 뒤에 삽입해야 안정성이 유지된다.
+        while (lo < hi)
+        {
+            size_t mid = lo + (hi - lo) / 2;
+
+            if (ctx->comp(pivot, arr + mid * of_size) < 0)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+
+        if (lo == i)
+            continue;
+
+        memcpy(temp, pivot, of_size);
+        memmove(arr + (lo + 1) * of_size, arr + lo * of_size, (i - lo) * of_size);
+        memcpy(arr + lo * of_size, temp, of_size);
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief key보다 큰 첫 요소의 위치 (upper bound)
+ * @param ctx 안정 정렬 상태
+ * @param base 탐색할 배열의 포인터
+ * @param n 탐색할 배열의 길이
+ * @param key 찾을 요소의 포인터
+ * @return 위치
+ */
+size_t __unds_stable_sort_upper_bound(struct __unds_stable_sort_t* ctx, const char* base, size_t n, const char* key)
+{
+    size_t lo = 0;
+
+    while (n > 0)
+    {
+        size_t half = n / 2;
+
+        if (ctx->comp(key, base + (lo + half) * ctx->of_size) < 0)
+            n = half;
+        else
+        {
+            lo += half + 1;
+            n -= half + 1;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief key보다 크거나 같은 첫 요소의 위치 (lower bound)
+ * @param ctx 안정 정렬 상태
+ * @param base 탐색할 배열의 포인터
+ * @param n 탐색할 배열의 길이
+ * @param key 찾을 요소의 포인터
+ * @return 위치
+ */
+size_t __unds_stable_sort_lower_bound(struct __unds_stable_sort_t* ctx, const char* base, size_t n, const char* key)
+{
+    size_t lo = 0;
+
+    while (n > 0)
+    {
+        size_t half = n / 2;
+
+        if (ctx->comp(base + (lo + half) * ctx->of_size, key) < 0)
+        {
+            lo += half + 1;
+            n -= half + 1;
+        }
+        else
+            n = half;
+    }
+
+    return lo;
+}
+
+/**
+ * *내부 함수
+ *
+ * 앞 구간을 작업 공간으로 옮긴 뒤 앞에서부터 병합한다. (na <= nb)
+ *
+ * @brief 이웃한 두 구간을 병합
+ * @param ctx 안정 정렬 상태
+ * @param a 앞 구간의 포인터
+ * @param na 앞 구간의 길이
+ * @param nb 뒤 구간의 길이
+ */
+void __unds_stable_sort_merge_lo(struct __unds_stable_sort_t* ctx, char* a, size_t na, size_t nb)
+{
+    size_t of_size = ctx->of_size;
+    char* left = ctx->buffer;
+    char* left_end = left + na * of_size;
+    char* right = a + na * of_size;
+    char* right_end = right + nb * of_size;
+    char* dest = a;
+
+    memcpy(left, a, na * of_size);
+
+    while (left != left_end && right != right_end)
+    {
+        if (ctx->comp(right, left) < 0)
+        {
+            memcpy(dest, right, of_size);
+            right += of_size;
+        }
+        else
+        {
+            memcpy(dest, left, of_size);
+            left += of_size;
+        }
+        dest += of_size;
+    }
+
+    // 뒤 구간의 나머지는 이미 제자리에 있다.
+    memcpy(dest, left, (size_t)(left_end - left));
+}
+
+/**
+ * *내부 함수
+ *
+ * 뒤 구간을 작업 공간으로 옮긴 뒤 뒤에서부터 병합한다. (na > nb)
+ *
+ * @brief 이웃한 두 구간을 병합
+ * @param ctx 안정 정렬 상태
+ * @param a 앞 구간의 포인터
+ * @param na 앞 구간의 길이
+ * @param nb 뒤 구간의 길이
+ */
+void __unds_stable_sort_merge_hi(struct __unds_stable_sort_t* ctx, char* a, size_t na, size_t nb)
+{
+    size_t of_size = ctx->of_size;
+    char* right = ctx->buffer;
+    char* right_end = right + nb * of_size;
+    char* left_end = a + na * of_size;
+    char* dest = left_end + nb * of_size;
+
+    memcpy(right, left_end, nb * of_size);
+
+    while (left_end != a && right_end != right)
+    {
+        dest -= of_size;
+
+        // 같으면 뒤 구간의 요소를 먼저 뒤에 놓아야 안정성이 유지된다.
+        if (ctx->comp(right_end - of_size, left_end - of_size) < 0)
+        {
+            left_end -= of_size;
+            memcpy(dest, left_end, of_size);
+        }
+        else
+        {
+            right_end -= of_size;
+            memcpy(dest, right_end, of_size);
+        }
+    }
+
+    // 앞 구간의 나머지는 이미 제자리에 있다.
+    memcpy(a, right, (size_t)(right_end - right));
+}
+
+/**
+ * *내부 함수
+ *
+ * 이미 제자리에 있는 앞뒤 요소는 이분 탐색으로 제외하고, 짧은 쪽을 작업 공간으로 옮겨 병합한다.
+ *
+ * @brief 구간 스택의 index번째와 index + 1번째 구간을 병합
+ * @param ctx 안정 정렬 상태
+ * @param index 병합할 구간의 위치
+ */
+void __unds_stable_sort_merge_at(struct __unds_stable_sort_t* ctx, size_t index)
+{
+    size_t of_size = ctx->of_size;
+    char* a = ctx->arr + ctx->run_base[index] * of_size;
+    size_t na = ctx->run_size[index];
+    char* b = a + na * of_size;
+    size_t nb = ctx->run_size[index + 1];
+
+    ctx->run_size[index] = na + nb;
+    for (size_t i = index + 1; i + 1 < ctx->num_runs; i++)
+    {
+        ctx->run_base[i] = ctx->run_base[i + 1];
+        ctx->run_size[i] = ctx->run_size[i + 1];
+    }
+    ctx->num_runs--;
+
+    // 이미 순서대로 놓여 있으면 병합하지 않는다.
+    if (ctx->comp(b - of_size, b) <= 0)
+        return;
+
+    size_t skip = __unds_stable_sort_upper_bound(ctx, a, na, b);
+    a += skip * of_size;
+    na -= skip;
+
+    nb = __unds_stable_sort_lower_bound(ctx, b, nb, b - of_size);
+
+    if (na <= nb)
+        __unds_stable_sort_merge_lo(ctx, a, na, nb);
+    else
+        __unds_stable_sort_merge_hi(ctx, a, na, nb);
+}
+
+/**
+ * *내부 함수
+ *
+ * 구간 길이가 run[i - 2] > run[i - 1] + run[i], run[i - 1] > run[i]를 만족할 때까지 병합한다.
+ *
+ * @brief 구간 스택의 불변식 유지
+ * @param ctx 안정 정렬 상태
+ */
+void __unds_stable_sort_collapse(struct __unds_stable_sort_t* ctx)
+{
+    size_t* len = ctx->run_size;
+
+    while (ctx->num_runs > 1)
+    {
+        size_t k = ctx->num_runs - 2;
+
+        if ((k > 0 && len[k - 1] <= len[k] + len[k + 1]) || (k > 1 && len[k - 2] <= len[k - 1] + len[k]))
+        {
+            if (k > 0 && len[k - 1] < len[k + 1])
+                k--;
+        }
+        else if (len[k] > len[k + 1])
+            break;
+
+        __unds_stable_sort_merge_at(ctx, k);
+    }
+}
+
+void unds_stable_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), void* buffer)
+{
+    if (size < 2)
+        return;
+
+    struct __unds_stable_sort_t ctx;
+    ctx.arr = (char*)arr;
+    ctx.of_size = of_size;
+    ctx.comp = comp;
+    ctx.buffer = (char*)buffer;
+    ctx.num_runs = 0;
+
+    if (buffer == NULL)
+    {
+        ctx.buffer = (char*)unds_malloc((size / 2 + 1) * of_size);
+        if (ctx.buffer == NULL)
+        {
+            fprintf(stderr, "stderr: Failed to allocate memory for sort in unds_stable_sort().\n");
+            abort();
+        }
+    }
+
+    size_t minrun = __unds_stable_sort_minrun(size);
+    size_t begin = 0;
+
+    while (begin < size)
+    {
+        size_t run = __unds_stable_sort_count_run(&ctx, begin, size);
+
+        if (run < minrun)
+        {
+            size_t force = size - begin < minrun ? size - begin : minrun;
+            __unds_stable_sort_insertion(&ctx, begin, begin + force, run);
+            run = force;
+        }
+
+        ctx.run_base[ctx.num_runs] = begin;
+        ctx.run_size[ctx.num_runs] = run;
+        ctx.num_runs++;
+        __unds_stable_sort_collapse(&ctx);
+
+        begin += run;
+    }
+
+    while (ctx.num_runs > 1)
+    {
+        size_t k = ctx.num_runs - 2;
+
+        if (k > 0 && ctx.run_size[k - 1] < ctx.run_size[k + 1])
+            k--;
+        __unds_stable_sort_merge_at(&ctx, k);
+    }
+
+    if (buffer == NULL)
+        unds_free(ctx.buffer);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief [begin, end) 구간에서 nth 위치의 요소를 제자리에 놓음
+ * @param ctx 정렬 문맥
+ * @param begin 구간의 시작
+ * @param end 구간의 끝
+ * @param nth 제자리에 놓을 위치
+ * @param bad_allowed 힙 정렬로 전환하기 전까지 허용되는 불균형 분할의 횟수
+ */
+void __unds_select_loop(struct __unds_sort_context_t* ctx, char* begin, char* end, char* nth, int bad_allowed)
+{
+    size_t of_size = ctx->of_size;
+    bool leftmost = true;
+
+    while (true)
+    {
+        size_t size = (size_t)(end - begin) / of_size;
+        if (size < __UNDS_SORT_INSERTION_THRESHOLD)
+        {
+            __unds_sort_insertion(ctx, begin, end, false);
+            return;
+        }
+
+        size_t s2 = size / 2;
+        if (size > __UNDS_SORT_NINTHER_THRESHOLD)
+        {
+            __unds_sort_sort3(ctx, begin, begin + s2 * of_size, end - of_size);
+            __unds_sort_sort3(ctx, begin + of_size, begin + (s2 - 1) * of_size, end - 2 * of_size);
+            __unds_sort_sort3(ctx, begin + 2 * of_size, begin + (s2 + 1) * of_size, end - 3 * of_size);
+            __unds_sort_sort3(ctx, begin + (s2 - 1) * of_size, begin + s2 * of_size, begin + (s2 + 1) * of_size);
+            __unds_sort_swap(begin, begin + s2 * of_size, of_size);
+        }
+        else
+            __unds_sort_sort3(ctx, begin + s2 * of_size, begin, end - of_size);
+
+        // 왼쪽 구간의 마지막 요소가 피벗과 같다면 피벗과 같은 요소를 왼쪽에 모은다.
+        // 모인 요소는 모두 피벗과 같으므로 nth가 그 안에 있으면 끝난다.
+        if (!leftmost && ctx->comp(begin - of_size, begin) >= 0)
+        {
+            char* equal_end = __unds_sort_partition_left(ctx, begin, end) + of_size;
+            if (nth < equal_end)
+                return;
+
+            begin = equal_end;
+            continue;
+        }
+
+        bool already;
+        char* pivot_pos = __unds_sort_partition_right(ctx, begin, end, &already);
+        size_t l_size = (size_t)(pivot_pos - begin) / of_size;
+        size_t r_size = (size_t)(end - pivot_pos) / of_size - 1;
+
+        if (nth == pivot_pos)
+            return;
+
+        if (l_size < size / 8 || r_size < size / 8)
+        {
+            if (--bad_allowed == 0)
+            {
+                __unds_sort_heap(ctx, begin, end);
+                return;
+            }
+
+            // 입력의 패턴을 깨뜨리기 위해 일부 요소를 섞는다.
+            if (l_size >= __UNDS_SORT_INSERTION_THRESHOLD)
+            {
+                __unds_sort_swap(begin, begin + l_size / 4 * of_size, of_size);
+                __unds_sort_swap(pivot_pos - of_size, pivot_pos - l_size / 4 * of_size, of_size);
+            }
+            if (r_size >= __UNDS_SORT_INSERTION_THRESHOLD)
+            {
+                __unds_sort_swap(pivot_pos + of_size, pivot_pos + (1 + r_size / 4) * of_size, of_size);
+                __unds_sort_swap(end - of_size, end - r_size / 4 * of_size, of_size);
+            }
+        }
+
+        if (nth < pivot_pos)
+            end = pivot_pos;
+        else
+        {
+            begin = pivot_pos + of_size;
+            leftmost = false;
+        }
+    }
+}
+
+void unds_nth_element(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), size_t n)
+{
+    if (n >= size || size < 2)
+        return;
+
+    union __unds_sort_small_temp_t small_temp;
+    char* temp = of_size <= sizeof(small_temp.buffer) ? small_temp.buffer : (char*)unds_malloc(of_size);
+    if (temp == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for selection in unds_nth_element().\n");
+        abort();
+    }
+
+    struct __unds_sort_context_t ctx;
+
+    ctx.of_size = of_size;
+    ctx.comp = comp;
+    ctx.temp = temp;
+
+    int bad_allowed = 0;
+    while ((size >> bad_allowed) > 1)
+        bad_allowed++;
+
+    __unds_select_loop(&ctx, (char*)arr, (char*)arr + size * of_size, (char*)arr + n * of_size, bad_allowed);
+
+    if (temp != small_temp.buffer)
+        unds_free(temp);
+}
+
+void unds_partial_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), size_t k)
+{
+    if (k >= size)
+    {
+        unds_sort(arr, size, of_size, comp);
+        return;
+    }
+
+    if (k == 0)
+        return;
+
+    // k - 1번째 요소를 제자리에 놓으면 그 앞에는 더 앞선 요소만 남는다.
+    unds_nth_element(arr, size, of_size, comp, k - 1);
+    unds_sort(arr, k - 1, of_size, comp);
+}
+
+/**
+ * *내부 자료형
+ *
+ * 힙 변환과 힙 정렬에 필요한 정보
+ */
+struct __unds_heap_context_t
+{
+    /**
+     * 단일 요소의 크기
+     */
+    size_t of_size;
+    /**
+     * 요소 비교 함수
+     */
+    int (*comp)(const void*, const void*);
+    /**
+     * 참이면 큰 요소가, 거짓이면 작은 요소가 뿌리로 간다.
+     */
+    bool max_heap;
+    /**
+     * 요소 하나를 담을 임시 공간
+     */
+    char* temp;
+};
+
+/**
+ * *내부 함수
+ *
+ * @brief 힙에서 p가 q보다 뿌리에 가까워야 하는지 여부 반환
+ * @param ctx 힙 문맥
+ * @param p 비교할 요소
+ * @param q 비교할 요소
+ * @return p가 q보다 앞서는지 여부
+ */
+bool __unds_heap_before(struct __unds_heap_context_t* ctx, const void* p, const void* q)
+{
+    return ctx->max_heap ? ctx->comp(q, p) < 0 : ctx->comp(p, q) < 0;
+}
+
+/**
+ * *내부 함수
+ *
+ * temp의 요소를 hole 자리에 넣는다. 더 앞선 자식을 구멍으로 끌어올리며 잎까지 내려간 뒤,
+ * temp가 들어갈 자리까지 다시 올라온다. (Floyd)
+ *
+ * @brief 구멍을 아래로 내려 힙 성질 복구
+ * @param ctx 힙 문맥
+ * @param base 힙의 시작
+ * @param hole 비어 있는 자리의 인덱스
+ * @param size 힙의 크기
+ */
+void __unds_heap_adjust(struct __unds_heap_context_t* ctx, char* base, size_t hole, size_t size)
+{
+    size_t of_size = ctx->of_size;
+    size_t top = hole;
+    size_t child;
+
+    while ((child = 2 * hole + 1) < size)
+    {
+        if (child + 1 < size && __unds_heap_before(ctx, base + (child + 1) * of_size, base + child * of_size))
+            child++;
+
+        memcpy(base + hole * of_size, base + child * of_size, of_size);
+        hole = child;
+    }
+
+    while (hole > top)
+    {
+        size_t parent = (hole - 1) / 2;
+        if (!__unds_heap_before(ctx, ctx->temp, base + parent * of_size))
+            break;
+
+        memcpy(base + hole * of_size, base + parent * of_size, of_size);
+        hole = parent;
+    }
+
+    memcpy(base + hole * of_size, ctx->temp, of_size);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 배열 전체를 힙으로 변환
+ * @param ctx 힙 문맥
+ * @param base 배열의 시작
+ * @param size 배열의 길이
+ */
+void __unds_heap_build(struct __unds_heap_context_t* ctx, char* base, size_t size)
+{
+    for (size_t i = size / 2; i-- > 0;)
+    {
+        memcpy(ctx->temp, base + i * ctx->of_size, ctx->of_size);
+        __unds_heap_adjust(ctx, base, i, size);
+    }
+}
+
+void unds_heapify(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*))
+{
+    if (size < 2)
+        return;
+
+    union __unds_sort_small_temp_t small_temp;
+    char* temp = of_size <= sizeof(small_temp.buffer) ? small_temp.buffer : (char*)unds_malloc(of_size);
+    if (temp == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for heapify in unds_heapify().\n");
+        abort();
+    }
+
+    struct __unds_heap_context_t ctx;
+
+    ctx.of_size = of_size;
+    ctx.comp = comp;
+    ctx.max_heap = false;
+    ctx.temp = temp;
+
+    __unds_heap_build(&ctx, (char*)arr, size);
+
+    if (temp != small_temp.buffer)
+        unds_free(temp);
+}
+
+void unds_heap_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*))
+{
+    if (size < 2)
+        return;
+
+    union __unds_sort_small_temp_t small_temp;
+    char* temp = of_size <= sizeof(small_temp.buffer) ? small_temp.buffer : (char*)unds_malloc(of_size);
+    if (temp == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for heap sort in unds_heap_sort().\n");
+        abort();
+    }
+
+    struct __unds_heap_context_t ctx;
+    char* base = (char*)arr;
+
+    ctx.of_size = of_size;
+    ctx.comp = comp;
+    ctx.max_heap = true;
+    ctx.temp = temp;
+
+    // 가장 뒤처진 요소를 뿌리에 두는 힙을 만든 뒤 뿌리를 배열의 뒤로 하나씩 보낸다.
+    __unds_heap_build(&ctx, base, size);
+    for (size_t i = size; i-- > 1;)
+    {
+        memcpy(temp, base + i * of_size, of_size);
+        memcpy(base + i * of_size, base, of_size);
+        __unds_heap_adjust(&ctx, base, 0, i);
+    }
+
+    if (temp != small_temp.buffer)
+        unds_free(temp);
+}
+
+#ifdef UNDS_USE_THREADS
+
+/**
+ * *내부 구조체
+ *
+ * 병렬 정렬에서 스레드 하나가 처리할 작업
+ * (정렬 작업이면 dest의 na개의 요소를 정렬하고, 병합 작업이면 a와 b를 dest에 병합한다.)
+ */
+struct __unds_parallel_sort_task_t
+{
+    const char* a;
+    size_t na;
+    const char* b;
+    size_t nb;
+    char* dest;
+    /**
+     * 정렬 작업에 사용할 임시 공간 (병합 작업이면 NULL)
+     */
+    char* temp;
+    size_t of_size;
+    int (*comp)(const void*, const void*);
+};
+
+/**
+ * *내부 구조체
+ *
+ * 작업 목록을 나누어 처리하는 스레드의 인자
+ */
+struct __unds_parallel_worker_t
+{
+    struct __unds_parallel_sort_task_t* tasks;
+    size_t count;
+    size_t index;
+    size_t stride;
+};
+
+/**
+ * *내부 함수
+ *
+ * @brief index번째부터 stride 간격으로 작업 처리
+ * @param arg struct __unds_parallel_worker_t 포인터
+ * @return NULL
+ */
+void* __unds_parallel_sort_worker(void* arg)
+{
+    struct __unds_parallel_worker_t* worker = (struct __unds_parallel_worker_t*)arg;
+
+    for (size_t i = worker->index; i < worker->count; i += worker->stride)
+    {
+        struct __unds_parallel_sort_task_t* task = &worker->tasks[i];
+
+        if (task->temp != NULL)
+            __unds_sort_with_temp(task->dest, task->na, task->of_size, task->comp, task->temp);
+        else
+            __unds_merge(task->a, task->na, task->b, task->nb, task->dest, task->of_size, task->comp);
+    }
+
+    return NULL;
+}
+
+/**
+ * *내부 함수
+ *
+ * 호출한 스레드도 작업에 참여한다.
+ *
+ * @brief 작업 목록을 num_threads개의 스레드로 처리
+ * @param tasks 작업 목록
+ * @param count 작업의 개수
+ * @param num_threads 사용할 스레드의 개수
+ * @param threads 스레드 핸들을 저장할 공간
+ * @param workers 스레드 인자를 저장할 공간
+ */
+void __unds_parallel_sort_run(struct __unds_parallel_sort_task_t* tasks, size_t count, size_t num_threads, pthread_t* threads, struct __unds_parallel_worker_t* workers)
+{
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        workers[i].tasks = tasks;
+        workers[i].count = count;
+        workers[i].index = i;
+        workers[i].stride = num_threads;
+    }
+
+    for (size_t i = 1; i < num_threads; i++)
+    {
+        if (pthread_create(&threads[i], NULL, __unds_parallel_sort_worker, &workers[i]) != 0)
+        {
+            fprintf(stderr, "stderr: Failed to create a thread in unds_parallel_sort().\n");
+            abort();
+        }
+    }
+
+    __unds_parallel_sort_worker(&workers[0]);
+
+    for (size_t i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+}
+
+void unds_parallel_sort(void* arr, size_t size, size_t of_size, int (*comp)(const void*, const void*), size_t num_threads)
+{
+    if (num_threads == 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = online > 0 ? (size_t)online : 1;
+    }
+    if (num_threads > size / 4096)
+        num_threads = size / 4096;
+
+    if (size < UNDS_PARALLEL_SORT_CUTOFF || num_threads <= 1)
+    {
+        unds_sort(arr, size, of_size, comp);
+        return;
+    }
+
+    char* buffer = (char*)unds_malloc(size * of_size);
+    char* temps = (char*)unds_malloc(num_threads * of_size);
+    size_t* bounds = (size_t*)unds_malloc((num_threads + 1) * sizeof(size_t));
+    struct __unds_parallel_sort_task_t* tasks = (struct __unds_parallel_sort_task_t*)unds_malloc(2 * num_threads * sizeof(struct __unds_parallel_sort_task_t));
+    pthread_t* threads = (pthread_t*)unds_malloc(num_threads * sizeof(pthread_t));
+    struct __unds_parallel_worker_t* workers = (struct __unds_parallel_worker_t*)unds_malloc(num_threads * sizeof(struct __unds_parallel_worker_t));
+    if (buffer == NULL || temps == NULL || bounds == NULL || tasks == NULL || threads == NULL || workers == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for sort in unds_parallel_sort().\n");
+        abort();
+    }
+
+    // 1단계: 구간별로 정렬
+    size_t runs = num_threads;
+    for (size_t i = 0; i <= runs; i++)
+        bounds[i] = size * i / runs;
+
+    for (size_t i = 0; i < runs; i++)
+    {
+        tasks[i].dest = (char*)arr + bounds[i] * of_size;
+        tasks[i].na = bounds[i + 1] - bounds[i];
+        tasks[i].temp = temps + i * of_size;
+        tasks[i].of_size = of_size;
+        tasks[i].comp = comp;
+    }
+    __unds_parallel_sort_run(tasks, runs, num_threads, threads, workers);
+
+    // 2단계: 인접한 구간을 짝지어 병합
+    char* src = (char*)arr;
+    char* dest = buffer;
+
+    while (runs > 1)
+    {
+        size_t pairs = (runs + 1) / 2;
+        size_t parts = num_threads / pairs > 0 ? num_threads / pairs : 1;
+        size_t count = 0;
+
+        for (size_t p = 0; p < pairs; p++)
+        {
+            const char* a = src + bounds[2 * p] * of_size;
+            size_t na = bounds[2 * p + 1] - bounds[2 * p];
+            const char* b = 2 * p + 1 < runs ? src + bounds[2 * p + 1] * of_size : a + na * of_size;
+            size_t nb = 2 * p + 1 < runs ? bounds[2 * p + 2] - bounds[2 * p + 1] : 0;
+            char* out = dest + bounds[2 * p] * of_size;
+
+            for (size_t j = 0; j < parts; j++)
+            {
+                size_t diag_begin = (na + nb) * j / parts;
+                size_t diag_end = (na + nb) * (j + 1) / parts;
+                size_t a_begin = __unds_merge_split(a, na, b, nb, diag_begin, of_size, comp);
+                size_t a_end = __unds_merge_split(a, na, b, nb, diag_end, of_size, comp);
+
+                tasks[count].a = a + a_begin * of_size;
+                tasks[count].na = a_end - a_begin;
+                tasks[count].b = b + (diag_begin - a_begin) * of_size;
+                tasks[count].nb = (diag_end - a_end) - (diag_begin - a_begin);
+                tasks[count].dest = out + diag_begin * of_size;
+                tasks[count].temp = NULL;
+                tasks[count].of_size = of_size;
+                tasks[count].comp = comp;
+                count++;
+            }
+        }
+        __unds_parallel_sort_run(tasks, count, num_threads, threads, workers);
+
+        for (size_t p = 0; p < pairs; p++)
+            bounds[p] = bounds[2 * p];
+        bounds[pairs] = size;
+        runs = pairs;
+
+        char* temp = src;
+        src = dest;
+        dest = temp;
+    }
+
+    // 결과가 작업 공간에 있으면 원래 배열로 나누어 복사한다.
+    if (src != (char*)arr)
+    {
+        for (size_t i = 0; i < num_threads; i++)
+        {
+            size_t begin = size * i / num_threads;
+            size_t end = size * (i + 1) / num_threads;
+
+            tasks[i].a = src + begin * of_size;
+            tasks[i].na = end - begin;
+            tasks[i].b = src + end * of_size;
+            tasks[i].nb = 0;
+            tasks[i].dest = (char*)arr + begin * of_size;
+            tasks[i].temp = NULL;
+            tasks[i].of_size = of_size;
+            tasks[i].comp = comp;
+        }
+        __unds_parallel_sort_run(tasks, num_threads, num_threads, threads, workers);
+    }
+
+    unds_free(workers);
+    unds_free(threads);
+    unds_free(tasks);
+    unds_free(bounds);
+    unds_free(temps);
+    unds_free(buffer);
+}
+
+#endif
+
+/**
+ * *내부 함수
+ *
+ * @brief 리스트 크기 2배 증가
+ * @param ths 대상 리스트 포인터
+ */
+void __unds_list_double(unds_list_t* ths)
+{
+    ths->capacity *= 2;
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity / 2, ths->capacity, ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for list in __list_double().\n");
+        abort();
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 리스트 크기 2배 감소
+ * @param ths 대상 리스트 포인터
+ */
+void __unds_list_half(unds_list_t* ths)
+{
+    if (ths->size == 0 || ths->capacity / 2 < ths->inline_capacity)
+        return;
+
+    ths->capacity /= 2;
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity * 2, ths->capacity, ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for list in __list_half().\n");
+        abort();
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 리스트의 크기를 2의 제곱수로 교정
+ * @param ths 대상 리스트 포인터
+ */
+void __unds_list_capacity_correction(unds_list_t* ths)
+{
+    size_t correct_capacity = 1;
+
+    while (correct_capacity <= ths->size)
+        correct_capacity *= 2;
+    if (correct_capacity < ths->inline_capacity)
+        correct_capacity = ths->inline_capacity;
+
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity, correct_capacity, ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for stack in __list_capacity_correction().\n");
+        abort();
+    }
+
+    ths->capacity = correct_capacity;
+}
+
+unds_list_t* unds_list_create(size_t of_size)
+{
+    unds_list_t* ths = (unds_list_t*)unds_malloc(sizeof(unds_list_t));
+
+    ths->arr = __unds_storage_alloc(of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for list in list_create().\n");
+        abort();
+    }
+
+    ths->capacity = 1;
+    ths->size = 0;
+    ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
+
+    return ths;
+}
+
+unds_list_t* unds_list_create_from_array(void* arr, size_t size, size_t of_size)
+{
+    if (arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to initialize list since the original array is NULL.\n");
+        abort();
+    }
+    else if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of list cannot be zero.");
+        abort();
+    }
+
+    unds_list_t* ths = (unds_list_t*)unds_malloc(sizeof(unds_list_t));
+
+    ths->arr = __unds_storage_alloc(size * of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for list in list_create_from_array().\n");
+        abort();
+    }
+
+    ths->capacity = size;
+    ths->size = size;
+    ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
+
+    memcpy(ths->arr, arr, size * of_size);
+    __unds_list_capacity_correction(ths);
+
+    return ths;
+}
+
+unds_list_t* unds_list_create_from_value(void* value, size_t size, size_t of_size)
+{
+    if (value == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to initialize list since the original array is NULL.\n");
+        abort();
+    }
+    else if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of list cannot be zero.");
+        abort();
+    }
+
+    unds_list_t* ths = (unds_list_t*)unds_malloc(sizeof(unds_list_t));
+    ths->arr = __unds_storage_alloc(size * of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for list in list_create_from_array().\n");
+        abort();
+    }
+
+    ths->capacity = size;
+    ths->size = size;
+    ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
+
+    for (size_t i = 0; i < size; i++)
+        memcpy((char*)ths->arr + i * of_size, value, of_size);
+    __unds_list_capacity_correction(ths);
+    
+    return ths;
+}
+
+unds_list_t* unds_list_create_inline(size_t of_size, size_t capacity)
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of list cannot be zero.\n");
+        abort();
+    }
+
+    capacity = __unds_inline_capacity(capacity);
+
+    unds_list_t* ths = (unds_list_t*)unds_malloc(__UNDS_INLINE_OFFSET(unds_list_t) + capacity * of_size);
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for list in unds_list_create_inline().\n");
+        abort();
+    }
+
+    unds_list_init(ths, of_size, capacity > 0 ? (char*)ths + __UNDS_INLINE_OFFSET(unds_list_t) : NULL, capacity);
+
+    return ths;
+}
+
+void unds_list_init(unds_list_t* ths, size_t of_size, void* storage, size_t capacity)
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of list cannot be zero.\n");
+        abort();
+    }
+
+    capacity = storage != NULL ? __unds_inline_capacity(capacity) : 0;
+
+    if (capacity == 0)
+    {
+        ths->arr = __unds_storage_alloc(of_size);
+        if (ths->arr == NULL)
+        {
+            fprintf(stderr, "stderr: Failed to allocate memory for list in unds_list_init().\n");
+            abort();
+        }
+
+        ths->capacity = 1;
+        ths->inline_arr = NULL;
+    }
+    else
+    {
+        ths->arr = storage;
+        ths->capacity = capacity;
+        ths->inline_arr = storage;
+    }
+
+    ths->inline_capacity = capacity;
+    ths->size = 0;
+    ths->of_size = of_size;
+}
+
+void unds_list_deinit(unds_list_t* ths)
+{
+    if (ths->arr != ths->inline_arr)
+        __unds_storage_free(ths->arr);
+
+    ths->arr = NULL;
+    ths->capacity = 0;
+    ths->size = 0;
+}
+
+void unds_list_delete(unds_list_t* ths)
+{
+    if (ths->arr != ths->inline_arr)
+        __unds_storage_free(ths->arr);
+    unds_free(ths);
+}
+
+bool unds_list_empty(unds_list_t* ths)
+{
+    return ths->size == 0;
+}
+
+void unds_list_push(unds_list_t* ths, void* value)
+{
+    if (ths->size == ths->capacity)
+        __unds_list_double(ths);
+
+    memcpy((char*)ths->arr + ths->size++ * ths->of_size, value, ths->of_size);
+}
+
+void unds_list_pop(unds_list_t* ths)
+{
+    if (unds_list_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop an element from list because the list is empty.\n");
+        abort();
+    }
+
+    ths->size--;
+
+    if (ths->size == ths->capacity / 2)
+        __unds_list_half(ths);
+}
+
+void unds_list_get(unds_list_t* ths, void* dest, size_t index)
+{
+    if (index >= ths->size)
+    {
+        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        abort();
+    }
+
+    memcpy(dest, (char*)ths->arr + index * ths->of_size, ths->of_size);
+}
+
+void unds_list_set(unds_list_t* ths, size_t index, void* value)
+{
+    if (index >= ths->size)
+    {
+        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        abort();
+    }
+
+    memcpy((char*)ths->arr + index * ths->of_size, value, ths->of_size);
+}
+
+void unds_list_insert(unds_list_t* ths, size_t index, void* value)
+{
+    if (index >= ths->size + 1)
+    {
+        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        abort();
+    }
+
+    if (ths->size == ths->capacity)
+        __unds_list_double(ths);
+
+    memmove((char*)ths->arr + (index + 1) * ths->of_size, (char*)ths->arr + index * ths->of_size, (ths->size - index) * ths->of_size);
+    memcpy((char*)ths->arr + index * ths->of_size, value, ths->of_size);
+
+    ths->size++;
+}
+
+void unds_list_insert_range(unds_list_t* ths, size_t index, void* arr, size_t n)
+{
+    if (index >= ths->size + 1)
+    {
+        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size + 1, index);
+        abort();
+    }
+
+    unds_list_reserve(ths, ths->size + n);
+
+    memmove((char*)ths->arr + (index + n) * ths->of_size, (char*)ths->arr + index * ths->of_size, (ths->size - index) * ths->of_size);
+    memcpy((char*)ths->arr + index * ths->of_size, arr, n * ths->of_size);
+
+    ths->size += n;
+}
+
+void unds_list_remove(unds_list_t* ths, size_t index)
+{
+    if (index >= ths->size)
+    {
+        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        abort();
+    }
+
+    memmove((char*)ths->arr + index * ths->of_size, (char*)ths->arr + (index + 1) * ths->of_size, (ths->size - index - 1) * ths->of_size);
+    unds_list_pop(ths);
+}
+
+void unds_list_swap_remove(unds_list_t* ths, size_t index)
+{
+    if (index >= ths->size)
+    {
+        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        abort();
+    }
+
+    if (index != ths->size - 1)
+        memcpy((char*)ths->arr + index * ths->of_size, (char*)ths->arr + (ths->size - 1) * ths->of_size, ths->of_size);
+    unds_list_pop(ths);
+}
+
+void unds_list_erase_range(unds_list_t* ths, size_t begin, size_t end)
+{
+    if (begin > end || end > ths->size)
+    {
+        fprintf(stderr, "stderr: List range out of range. Expected [begin, end) within %zu but found [%zu, %zu).\n", ths->size, begin, end);
+        abort();
+    }
+
+    memmove((char*)ths->arr + begin * ths->of_size, (char*)ths->arr + end * ths->of_size, (ths->size - end) * ths->of_size);
+    ths->size -= end - begin;
+
+    if (ths->size > 0 && ths->size <= ths->capacity / 4)
+        __unds_list_capacity_correction(ths);
+}
+
+size_t unds_list_erase_if(unds_list_t* ths, bool (*pred)(const void* elem, void* ctx), void* ctx)
+{
+    size_t write = 0;
+    size_t run_begin = 0;
+
+    // 남길 요소가 연속된 구간은 한 번의 memmove로 옮긴다.
+    for (size_t i = 0; i < ths->size; i++)
+    {
+        if (!pred((char*)ths->arr + i * ths->of_size, ctx))
+            continue;
+
+        if (run_begin != write)
+            memmove((char*)ths->arr + write * ths->of_size, (char*)ths->arr + run_begin * ths->of_size, (i - run_begin) * ths->of_size);
+        write += i - run_begin;
+        run_begin = i + 1;
+    }
+
+    if (run_begin != write)
+        memmove((char*)ths->arr + write * ths->of_size, (char*)ths->arr + run_begin * ths->of_size, (ths->size - run_begin) * ths->of_size);
+    write += ths->size - run_begin;
+
+    size_t removed = ths->size - write;
+    ths->size = write;
+
+    if (ths->size > 0 && ths->size <= ths->capacity / 4)
+        __unds_list_capacity_correction(ths);
+
+    return removed;
+}
+
+void unds_list_clear(unds_list_t* ths)
+{
+    size_t capacity = ths->inline_capacity > 0 ? ths->inline_capacity : 1;
+
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity, capacity, ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for list in list_clear().\n");
+        abort();
+    }
+
+    ths->capacity = capacity;
+    ths->size = 0;
+}
+
+void unds_list_reserve(unds_list_t* ths, size_t capacity)
+{
+    if (capacity <= ths->capacity)
+        return;
+
+    size_t correct_capacity = __unds_grow_capacity(ths->capacity, capacity, ths->of_size, "unds_list_reserve");
+
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity, correct_capacity, ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for list in unds_list_reserve().\n");
+        abort();
+    }
+
+    ths->capacity = correct_capacity;
+}
+
+void unds_list_shrink_to_fit(unds_list_t* ths)
+{
+    __unds_list_capacity_correction(ths);
+}
+
+void unds_list_push_n(unds_list_t* ths, void* arr, size_t n)
+{
+    unds_list_reserve(ths, ths->size + n);
+
+    memcpy((char*)ths->arr + ths->size * ths->of_size, arr, n * ths->of_size);
+    ths->size += n;
+}
+
+void unds_list_pop_n(unds_list_t* ths, void* dest, size_t n)
+{
+    if (n > ths->size)
+    {
+        fprintf(stderr, "stderr: Failed to pop %zu elements from list because the list has only %zu.\n", n, ths->size);
+        abort();
+    }
+
+    ths->size -= n;
+
+    if (dest != NULL)
+        memcpy(dest, (char*)ths->arr + ths->size * ths->of_size, n * ths->of_size);
+
+    if (ths->size > 0 && ths->size <= ths->capacity / 4)
+        __unds_list_capacity_correction(ths);
+}
+
+void unds_list_append(unds_list_t* ths, unds_list_t* other)
+{
+    if (ths->of_size != other->of_size)
+    {
+        fprintf(stderr, "stderr: Failed to append list because the sizes of a single element differ.\n");
+        abort();
+    }
+
+    size_t n = other->size;
+
+    // other가 ths 자신이어도 공간을 먼저 확보하면 안전하게 복사할 수 있다.
+    unds_list_reserve(ths, ths->size + n);
+
+    memcpy((char*)ths->arr + ths->size * ths->of_size, other->arr, n * ths->of_size);
+    ths->size += n;
+}
+
+void unds_list_sort(unds_list_t* ths, int (*comp)(const void*, const void*))
+{
+    unds_sort(ths->arr, ths->size, ths->of_size, comp);
+}
+
+void unds_list_stable_sort(unds_list_t* ths, int (*comp)(const void*, const void*), void* buffer)
+{
+    unds_stable_sort(ths->arr, ths->size, ths->of_size, comp, buffer);
+}
+
+void unds_list_nth_element(unds_list_t* ths, int (*comp)(const void*, const void*), size_t n)
+{
+    if (n >= ths->size)
+    {
+        fprintf(stderr, "stderr: Index out of range in unds_list_nth_element().\n");
+        abort();
+    }
+
+    unds_nth_element(ths->arr, ths->size, ths->of_size, comp, n);
+}
+
+void unds_list_partial_sort(unds_list_t* ths, int (*comp)(const void*, const void*), size_t k)
+{
+    unds_partial_sort(ths->arr, ths->size, ths->of_size, comp, k);
+}
+
+/**
+ * *내부 함수
+ *
+ * 부호와 무관하게 부호 없는 정수의 대소 관계로 비교할 수 있도록 키를 변환한다.
+ *
+ * @brief 요소의 키를 기수 정렬용 정수로 변환
+ * @param elem 대상 요소의 포인터
+ * @param key_offset 요소 내에서 키의 위치
+ * @param key_type 키의 자료형
+ * @return 변환된 키
+ */
+uint64_t __unds_radix_key(const char* elem, size_t key_offset, unds_radix_key_t key_type)
+{
+    uint32_t key32;
+    uint64_t key64;
+
+    switch (key_type)
+    {
+    case UNDS_RADIX_KEY_U32:
+        memcpy(&key32, elem + key_offset, sizeof(uint32_t));
+        return key32;
+    case UNDS_RADIX_KEY_I32:
+        memcpy(&key32, elem + key_offset, sizeof(uint32_t));
+        return key32 ^ 0x80000000u;
+    case UNDS_RADIX_KEY_F32:
+        memcpy(&key32, elem + key_offset, sizeof(uint32_t));
+        return (key32 & 0x80000000u) ? ~key32 : key32 ^ 0x80000000u;
+    case UNDS_RADIX_KEY_U64:
+        memcpy(&key64, elem + key_offset, sizeof(uint64_t));
+        return key64;
+    case UNDS_RADIX_KEY_I64:
+        memcpy(&key64, elem + key_offset, sizeof(uint64_t));
+        return key64 ^ 0x8000000000000000u;
+    case UNDS_RADIX_KEY_F64:
+        memcpy(&key64, elem + key_offset, sizeof(uint64_t));
+        return (key64 & 0x8000000000000000u) ? ~key64 : key64 ^ 0x8000000000000000u;
+    }
+
+    return 0;
+}
+
+void unds_list_radix_sort(unds_list_t* ths, size_t key_offset, unds_radix_key_t key_type, void* buffer)
+{
+    size_t n = ths->size;
+    size_t of_size = ths->of_size;
+    size_t key_size = key_type == UNDS_RADIX_KEY_U32 || key_type == UNDS_RADIX_KEY_I32 || key_type == UNDS_RADIX_KEY_F32 ? 4 : 8;
+
+    if (key_offset + key_size > of_size)
+    {
+        fprintf(stderr, "stderr: Radix sort key does not fit in a single element of list.\n");
+        abort();
+    }
+
+    if (n < 2)
+        return;
+
+    char* scratch = (char*)buffer;
+    if (scratch == NULL)
+    {
+        scratch = (char*)unds_malloc(n * of_size);
+        if (scratch == NULL)
+        {
+            fprintf(stderr, "stderr: Failed to allocate memory for list in unds_list_radix_sort().\n");
+            abort();
+        }
+    }
+
+    // 모든 자리의 도수를 한 번의 순회로 센다.
+    size_t (*counts)[256] = (size_t(*)[256])unds_calloc(key_size * 256, sizeof(size_t));
+    if (counts == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for list in unds_list_radix_sort().\n");
+        abort();
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        uint64_t key = __unds_radix_key((char*)ths->arr + i * of_size, key_offset, key_type);
+        for (size_t pass = 0; pass < key_size; pass++)
+            counts[pass][(key >> (pass * 8)) & 0xff]++;
+    }
+
+    char* src = (char*)ths->arr;
+    char* dst = scratch;
+
+    for (size_t pass = 0; pass < key_size; pass++)
+    {
+        size_t* count = counts[pass];
+
+        if (count[(__unds_radix_key(src, key_offset, key_type) >> (pass * 8)) & 0xff] == n)
+            continue;
+
+        size_t offset = 0;
+        for (size_t digit = 0; digit < 256; digit++)
+        {
+            size_t c = count[digit];
+            count[digit] = offset;
+            offset += c;
+        }
+
+        unsigned shift = (unsigned)(pass * 8);
+
+        if (of_size == sizeof(uint32_t))
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                size_t digit = (__unds_radix_key(src + i * 4, key_offset, key_type) >> shift) & 0xff;
+                memcpy(dst + count[digit]++ * 4, src + i * 4, 4);
+            }
+        }
+        else if (of_size == sizeof(uint64_t))
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                size_t digit = (__unds_radix_key(src + i * 8, key_offset, key_type) >> shift) & 0xff;
+                memcpy(dst + count[digit]++ * 8, src + i * 8, 8);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                size_t digit = (__unds_radix_key(src + i * of_size, key_offset, key_type) >> shift) & 0xff;
+                memcpy(dst + count[digit]++ * of_size, src + i * of_size, of_size);
+            }
+        }
+
+        char* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != (char*)ths->arr)
+        memcpy(ths->arr, src, n * of_size);
+
+    unds_free(counts);
+    if (buffer == NULL)
+        unds_free(scratch);
+}
+
+#ifdef UNDS_USE_THREADS
+
+void unds_list_parallel_sort(unds_list_t* ths, int (*comp)(const void*, const void*), size_t num_threads)
+{
+    unds_parallel_sort(ths->arr, ths->size, ths->of_size, comp, num_threads);
+}
+
+#endif
+
+size_t unds_list_lower_bound(unds_list_t* ths, const void* key, int (*comp)(const void*, const void*))
+{
+    if (ths->size == 0)
+        return 0;
+
+    const char* base = (const char*)ths->arr;
+    size_t n = ths->size;
+
+    while (n > 1)
+    {
+        size_t half = n / 2;
+        // 다음 단계에서 비교할 두 후보를 미리 읽어 둔다.
+        __UNDS_PREFETCH(base + (n / 4) * ths->of_size);
+        __UNDS_PREFETCH(base + (half + n / 4) * ths->of_size);
+        base = comp(base + (half - 1) * ths->of_size, key) < 0 ? base + half * ths->of_size : base;
+        n -= half;
+    }
+
+    return (size_t)(base - (const char*)ths->arr) / ths->of_size + (comp(base, key) < 0);
+}
+
+size_t unds_list_upper_bound(unds_list_t* ths, const void* key, int (*comp)(const void*, const void*))
+{
+    if (ths->size == 0)
+        return 0;
+
+    const char* base = (const char*)ths->arr;
+    size_t n = ths->size;
+
+    while (n > 1)
+    {
+        size_t half = n / 2;
+        __UNDS_PREFETCH(base + (n / 4) * ths->of_size);
+        __UNDS_PREFETCH(base + (half + n / 4) * ths->of_size);
+        base = comp(key, base + (half - 1) * ths->of_size) >= 0 ? base + half * ths->of_size : base;
+        n -= half;
+    }
+
+    return (size_t)(base - (const char*)ths->arr) / ths->of_size + (comp(key, base) >= 0);
+}
+
+size_t unds_list_equal_range(unds_list_t* ths, const void* key, int (*comp)(const void*, const void*), size_t* first, size_t* last)
+{
+    *first = unds_list_lower_bound(ths, key, comp);
+    *last = *first;
+
+    while (*last < ths->size && comp(key, (char*)ths->arr + *last * ths->of_size) == 0)
+    {
+        // 같은 요소가 많으면 나머지 구간에서 이분 탐색으로 끝을 찾는다.
+        if (*last - *first == 8)
+        {
+            unds_list_t rest = *ths;
+            rest.arr = (char*)ths->arr + *last * ths->of_size;
+            rest.size = ths->size - *last;
+            *last += unds_list_upper_bound(&rest, key, comp);
+            break;
+        }
+        (*last)++;
+    }
+
+    return *last - *first;
+}
+
+size_t unds_list_sorted_insert(unds_list_t* ths, void* value, int (*comp)(const void*, const void*))
+{
+    size_t index = unds_list_upper_bound(ths, value, comp);
+    unds_list_insert(ths, index, value);
+
+    return index;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 정렬된 src를 중위 순회 순서로 dest의 k번째 노드(1부터 시작)에 채움
+ * @param src 정렬된 배열의 포인터
+ * @param dest Eytzinger 배치로 채울 배열의 포인터
+ * @param i 다음에 채울 src의 위치
+ * @param k 채울 노드의 번호 (1부터 시작)
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @return 다음에 채울 src의 위치
+ */
+size_t __unds_eytzinger_fill(const char* src, char* dest, size_t i, size_t k, size_t size, size_t of_size)
+{
+    if (k <= size)
+    {
+        i = __unds_eytzinger_fill(src, dest, i, 2 * k, size, of_size);
+        memcpy(dest + (k - 1) * of_size, src + i * of_size, of_size);
+        i++;
+        i = __unds_eytzinger_fill(src, dest, i, 2 * k + 1, size, of_size);
+    }
+
+    return i;
+}
+
+void unds_list_eytzinger_layout(unds_list_t* ths)
+{
+    char* sorted = (char*)unds_malloc(ths->size * ths->of_size + 1);
+    if (sorted == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for layout in unds_list_eytzinger_layout().\n");
+        abort();
+    }
+
+    memcpy(sorted, ths->arr, ths->size * ths->of_size);
+    __unds_eytzinger_fill(sorted, (char*)ths->arr, 0, 1, ths->size, ths->of_size);
+
+    unds_free(sorted);
+}
+
+size_t unds_list_eytzinger_search(unds_list_t* ths, const void* key, int (*comp)(const void*, const void*))
+{
+    const char* arr = (const char*)ths->arr;
+    size_t of_size = ths->of_size;
+    size_t k = 1;
+
+    while (k <= ths->size)
+    {
+        // 4단계 아래 자손들은 연속해서 놓여 있으므로 미리 읽어 둔다.
+        if (16 * k <= ths->size)
+            __UNDS_PREFETCH(arr + (16 * k - 1) * of_size);
+        k = 2 * k + (comp(arr + (k - 1) * of_size, key) < 0);
+    }
+
+    // 마지막으로 왼쪽으로 내려간 노드가 답이다. (오른쪽으로 내려간 단계와 그 한 단계를 되돌린다.)
+#if defined(__GNUC__) || defined(__clang__)
+    k >>= __builtin_ctzll(~(unsigned long long)k) + 1;
+#else
+    while (k & 1)
+        k >>= 1;
+    k >>= 1;
+#endif
+
+    return k == 0 ? ths->size : k - 1;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief from부터 value와 같은 요소를 하나씩 비교하여 탐색
+ * @param arr 배열의 포인터
+ * @param from 탐색을 시작할 위치
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param value 찾을 값의 포인터
+ * @param count 참이면 같은 요소의 개수, 거짓이면 첫 위치(없으면 size)를 계산
+ * @return 첫 위치 또는 같은 요소의 개수
+ */
+size_t __unds_scan_find_scalar(const char* arr, size_t from, size_t size, size_t of_size, const void* value, bool count)
+{
+    size_t result = 0;
+
+#define __UNDS_SCAN_FIND_SCALAR_LOOP(width)                      \
+    for (size_t i = from; i < size; i++)                         \
+    {                                                            \
+        if (memcmp(arr + i * (width), value, (width)) == 0)      \
+        {                                                        \
+            if (!count)                                          \
+                return i;                                        \
+            result++;                                            \
+        }                                                        \
+    }
+
+    // 크기가 상수이면 memcmp가 정수 비교로 바뀐다.
+    switch (of_size)
+    {
+    case 1:
+        __UNDS_SCAN_FIND_SCALAR_LOOP(1);
+        break;
+    case 2:
+        __UNDS_SCAN_FIND_SCALAR_LOOP(2);
+        break;
+    case 4:
+        __UNDS_SCAN_FIND_SCALAR_LOOP(4);
+        break;
+    case 8:
+        __UNDS_SCAN_FIND_SCALAR_LOOP(8);
+        break;
+    default:
+        __UNDS_SCAN_FIND_SCALAR_LOOP(of_size);
+        break;
+    }
+
+#undef __UNDS_SCAN_FIND_SCALAR_LOOP
+
+    return count ? result : size;
+}
+
+#ifdef __UNDS_SCAN_X86
+
+/**
+ * *내부 매크로
+ *
+ * 비교 결과의 바이트 마스크를 요소마다 첫 바이트의 비트 하나만 남긴 마스크로 바꾸어
+ * 위치는 (i + ctz(mask)) / of_size, 개수는 popcount(mask)로 구한다.
+ */
+#define __UNDS_SCAN_FIND_SIMD_LOOP(block, load, compare, movemask, pattern, popcount, ctz) \
+    for (; i + (block) <= bytes; i += (block))                                              \
+    {                                                                                       \
+        uint32_t mask = (uint32_t)movemask(compare(load(arr + i), needle)) & (pattern);    \
+        if (count)                                                                          \
+            result += (size_t)popcount(mask);                                               \
+        else if (mask != 0)                                                                 \
+            return (i + (size_t)ctz(mask)) / of_size;                                       \
+    }
+
+#ifdef __SSE2__
+
+/**
+ * *내부 함수
+ *
+ * SSE2에는 64비트 비교가 없으므로 32비트 비교 결과의 두 절반이 모두 같은 경우만 남긴다.
+ *
+ * @brief 64비트 요소의 16바이트 블록 비교 마스크 계산
+ * @param v 비교할 블록
+ * @param needle 찾을 값으로 채운 블록
+ * @return 비교 결과 (같은 요소의 모든 바이트가 0xFF)
+ */
+__m128i __unds_scan_cmpeq_epi64_sse2(__m128i v, __m128i needle)
+{
+    __m128i eq = _mm_cmpeq_epi32(v, needle);
+    return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+#define __unds_scan_loadu_sse2(p) _mm_loadu_si128((const __m128i*)(p))
+
+/**
+ * *내부 함수
+ *
+ * @brief SSE2로 value와 같은 요소 탐색 (__unds_scan_find_scalar 참고)
+ * @param arr 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기 (1, 2, 4, 8)
+ * @param value 찾을 값의 포인터
+ * @param count 참이면 같은 요소의 개수, 거짓이면 첫 위치(없으면 size)를 계산
+ * @return 첫 위치 또는 같은 요소의 개수
+ */
+size_t __unds_scan_find_sse2(const char* arr, size_t size, size_t of_size, const void* value, bool count)
+{
+    size_t bytes = size * of_size;
+    size_t result = 0;
+    size_t i = 0;
+    __m128i needle;
+
+    switch (of_size)
+    {
+    case 1:
+    {
+        int8_t x;
+        memcpy(&x, value, 1);
+        needle = _mm_set1_epi8(x);
+        __UNDS_SCAN_FIND_SIMD_LOOP(16, __unds_scan_loadu_sse2, _mm_cmpeq_epi8, _mm_movemask_epi8, 0xFFFFu, __builtin_popcount, __builtin_ctz);
+        break;
+    }
+    case 2:
+    {
+        int16_t x;
+        memcpy(&x, value, 2);
+        needle = _mm_set1_epi16(x);
+        __UNDS_SCAN_FIND_SIMD_LOOP(16, __unds_scan_loadu_sse2, _mm_cmpeq_epi16, _mm_movemask_epi8, 0x5555u, __builtin_popcount, __builtin_ctz);
+        break;
+    }
+    case 4:
+    {
+        int32_t x;
+        memcpy(&x, value, 4);
+        needle = _mm_set1_epi32(x);
+        __UNDS_SCAN_FIND_SIMD_LOOP(16, __unds_scan_loadu_sse2, _mm_cmpeq_epi32, _mm_movemask_epi8, 0x1111u, __builtin_popcount, __builtin_ctz);
+        break;
+    }
+    default:
+    {
+        int64_t x;
+        memcpy(&x, value, 8);
+        needle = _mm_set1_epi64x(x);
+        __UNDS_SCAN_FIND_SIMD_LOOP(16, __unds_scan_loadu_sse2, __unds_scan_cmpeq_epi64_sse2, _mm_movemask_epi8, 0x0101u, __builtin_popcount, __builtin_ctz);
+        break;
+    }
+    }
+
+    if (count)
+        return result + __unds_scan_find_scalar(arr, i / of_size, size, of_size, value, true);
+    return __unds_scan_find_scalar(arr, i / of_size, size, of_size, value, false);
+}
+
+#endif
+
+#define __unds_scan_loadu_avx2(p) _mm256_loadu_si256((const __m256i*)(p))
+
+/**
+ * *내부 함수
+ *
+ * @brief AVX2로 value와 같은 요소 탐색 (__unds_scan_find_scalar 참고)
+ * @param arr 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기 (1, 2, 4, 8)
+ * @param value 찾을 값의 포인터
+ * @param count 참이면 같은 요소의 개수, 거짓이면 첫 위치(없으면 size)를 계산
+ * @return 첫 위치 또는 같은 요소의 개수
+ */
+__attribute__((target("avx2"))) size_t __unds_scan_find_avx2(const char* arr, size_t size, size_t of_size, const void* value, bool count)
+{
+    size_t bytes = size * of_size;
+    size_t result = 0;
+    size_t i = 0;
+    __m256i needle;
+
+    switch (of_size)
+    {
+    case 1:
+    {
+        int8_t x;
+        memcpy(&x, value, 1);
+        needle = _mm256_set1_epi8(x);
+        __UNDS_SCAN_FIND_SIMD_LOOP(32, __unds_scan_loadu_avx2, _mm256_cmpeq_epi8, _mm256_movemask_epi8, 0xFFFFFFFFu, __builtin_popcount, __builtin_ctz);
+        break;
+    }
+    case 2:
+    {
+        int16_t x;
+        memcpy(&x, value, 2);
+        needle = _mm256_set1_epi16(x);
+        __UNDS_SCAN_FIND_SIMD_LOOP(32, __unds_scan_loadu_avx2, _mm256_cmpeq_epi16, _mm256_movemask_epi8, 0x55555555u, __builtin_popcount, __builtin_ctz);
+        break;
+    }
+    case 4:
+    {
+        int32_t x;
+        memcpy(&x, value, 4);
+        needle = _mm256_set1_epi32(x);
+        __UNDS_SCAN_FIND_SIMD_LOOP(32, __unds_scan_loadu_avx2, _mm256_cmpeq_epi32, _mm256_movemask_epi8, 0x11111111u, __builtin_popcount, __builtin_ctz);
+        break;
+    }
+    default:
+    {
+        int64_t x;
+        memcpy(&x, value, 8);
+        needle = _mm256_set1_epi64x(x);
+        __UNDS_SCAN_FIND_SIMD_LOOP(32, __unds_scan_loadu_avx2, _mm256_cmpeq_epi64, _mm256_movemask_epi8, 0x01010101u, __builtin_popcount, __builtin_ctz);
+        break;
+    }
+    }
+
+    if (count)
+        return result + __unds_scan_find_scalar(arr, i / of_size, size, of_size, value, true);
+    return __unds_scan_find_scalar(arr, i / of_size, size, of_size, value, false);
+}
+
+#undef __UNDS_SCAN_FIND_SIMD_LOOP
+
+#endif
+
+/**
+ * *내부 함수
+ *
+ * @brief 사용할 수 있는 가장 넓은 SIMD로 value와 같은 요소 탐색 (__unds_scan_find_scalar 참고)
+ * @param arr 배열의 포인터
+ * @param size 배열의 길이
+ * @param of_size 배열의 단일 요소의 크기
+ * @param value 찾을 값의 포인터
+ * @param count 참이면 같은 요소의 개수, 거짓이면 첫 위치(없으면 size)를 계산
+ * @return 첫 위치 또는 같은 요소의 개수
+ */
+size_t __unds_scan_find(const char* arr, size_t size, size_t of_size, const void* value, bool count)
+{
+#ifdef __UNDS_SCAN_X86
+    if (of_size == 1 || of_size == 2 || of_size == 4 || of_size == 8)
+    {
+        // target("avx2")는 컴파일러에 따라 POPCNT 명령을 함께 허용하므로 둘 다 확인한다.
+        // (__builtin_ctz는 BMI가 없는 CPU에서도 동작하는 명령으로 컴파일된다.)
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+            return __unds_scan_find_avx2(arr, size, of_size, value, count);
+#ifdef __SSE2__
+        return __unds_scan_find_sse2(arr, size, of_size, value, count);
+#endif
+    }
+#endif
+
+    return __unds_scan_find_scalar(arr, 0, size, of_size, value, count);
+}
+
+size_t unds_list_find(unds_list_t* ths, const void* value)
+{
+    return __unds_scan_find((const char*)ths->arr, ths->size, ths->of_size, value, false);
+}
+
+size_t unds_list_count(unds_list_t* ths, const void* value)
+{
+    return __unds_scan_find((const char*)ths->arr, ths->size, ths->of_size, value, true);
+}
+
+bool unds_list_contains(unds_list_t* ths, const void* value)
+{
+    return unds_list_find(ths, value) != ths->size;
+}
+
+/**
+ * *내부 상수
+ *
+ * 최솟값, 최댓값, 합을 구할 때 사용하는 독립된 누적 변수의 전체 크기(바이트)
+ * (누적 변수를 나누어 두면 컴파일러가 반복문을 SIMD로 바꿀 수 있다.)
+ */
+#define __UNDS_SCAN_ACC_BYTES 64
+
+/**
+ * *내부 매크로
+ *
+ * 자료형 하나에 대한 최솟값, 최댓값, 합 함수를 정의한다.
+ * suffix와 attr을 바꾸어 같은 코드를 기본 대상과 AVX2 대상으로 각각 컴파일한다.
+ */
+#define __UNDS_SCAN_DEFINE_REDUCE(name, type, sum_type, suffix, attr)                                 \
+    attr type __unds_scan_min_##name##suffix(const type* arr, size_t size)                            \
+    {                                                                                                 \
+        enum { lanes = __UNDS_SCAN_ACC_BYTES / sizeof(type) };                                        \
+        type acc[lanes];                                                                              \
+        size_t i = 0;                                                                                 \
+        for (size_t j = 0; j < lanes; j++)                                                            \
+            acc[j] = arr[0];                                                                          \
+        for (; i + lanes <= size; i += lanes)                                                         \
+            for (size_t j = 0; j < lanes; j++)                                                        \
+                acc[j] = arr[i + j] < acc[j] ? arr[i + j] : acc[j];                                   \
+        for (; i < size; i++)                                                                         \
+            acc[0] = arr[i] < acc[0] ? arr[i] : acc[0];                                               \
+        for (size_t j = 1; j < lanes; j++)                                                            \
+            acc[0] = acc[j] < acc[0] ? acc[j] : acc[0];                                               \
+        return acc[0];                                                                                \
+    }                                                                                                 \
+    attr type __unds_scan_max_##name##suffix(const type* arr, size_t size)                            \
+    {                                                                                                 \
+        enum { lanes = __UNDS_SCAN_ACC_BYTES / sizeof(type) };                                        \
+        type acc[lanes];                                                                              \
+        size_t i = 0;                                                                                 \
+        for (size_t j = 0; j < lanes; j++)                                                            \
+            acc[j] = arr[0];                                                                          \
+        for (; i + lanes <= size; i += lanes)                                                         \
+            for (size_t j = 0; j < lanes; j++)                                                        \
+                acc[j] = arr[i + j] > acc[j] ? arr[i + j] : acc[j];                                   \
+        for (; i < size; i++)                                                                         \
+            acc[0] = arr[i] > acc[0] ? arr[i] : acc[0];                                               \
+        for (size_t j = 1; j < lanes; j++)                                                            \
+            acc[0] = acc[j] > acc[0] ? acc[j] : acc[0];                                               \
+        return acc[0];                                                                                \
+    }                                                                                                 \
+    attr sum_type __unds_scan_sum_##name##suffix(const type* arr, size_t size)                        \
+    {                                                                                                 \
+        enum { lanes = __UNDS_SCAN_ACC_BYTES / sizeof(sum_type) };                                    \
+        sum_type acc[lanes] = {0};                                                                    \
+        size_t i = 0;                                                                                 \
+        for (; i + lanes <= size; i += lanes)                                                         \
+            for (size_t j = 0; j < lanes; j++)                                                        \
+                acc[j] += (sum_type)arr[i + j];                                                       \
+        for (; i < size; i++)                                                                         \
+            acc[0] += (sum_type)arr[i];                                                               \
+        for (size_t j = 1; j < lanes; j++)                                                            \
+            acc[0] += acc[j];                                                                         \
+        return acc[0];                                                                                \
+    }
+
+#define __UNDS_SCAN_DEFINE_REDUCE_ALL(suffix, attr)                          \
+    __UNDS_SCAN_DEFINE_REDUCE(i8, int8_t, int64_t, suffix, attr)             \
+    __UNDS_SCAN_DEFINE_REDUCE(u8, uint8_t, uint64_t, suffix, attr)           \
+    __UNDS_SCAN_DEFINE_REDUCE(i16, int16_t, int64_t, suffix, attr)           \
+    __UNDS_SCAN_DEFINE_REDUCE(u16, uint16_t, uint64_t, suffix, attr)         \
+    __UNDS_SCAN_DEFINE_REDUCE(i32, int32_t, int64_t, suffix, attr)           \
+    __UNDS_SCAN_DEFINE_REDUCE(u32, uint32_t, uint64_t, suffix, attr)         \
+    __UNDS_SCAN_DEFINE_REDUCE(i64, int64_t, int64_t, suffix, attr)           \
+    __UNDS_SCAN_DEFINE_REDUCE(u64, uint64_t, uint64_t, suffix, attr)         \
+    __UNDS_SCAN_DEFINE_REDUCE(f32, float, double, suffix, attr)              \
+    __UNDS_SCAN_DEFINE_REDUCE(f64, double, double, suffix, attr)
+
+__UNDS_SCAN_DEFINE_REDUCE_ALL(, )
+#ifdef __UNDS_SCAN_X86
+__UNDS_SCAN_DEFINE_REDUCE_ALL(_avx2, __attribute__((target("avx2"))))
+#endif
+
+/**
+ * *내부 매크로
+ *
+ * AVX2를 사용할 수 있으면 AVX2 대상으로 컴파일된 함수를 호출한다.
+ */
+#ifdef __UNDS_SCAN_X86
+#define __UNDS_SCAN_CALL(op, name, arr, size) \
+    (__builtin_cpu_supports("avx2") ? __unds_scan_##op##_##name##_avx2(arr, size) : __unds_scan_##op##_##name(arr, size))
+#else
+#define __UNDS_SCAN_CALL(op, name, arr, size) __unds_scan_##op##_##name(arr, size)
+#endif
+
+/**
+ * *내부 매크로
+ *
+ * type에 맞는 함수를 호출하여 결과를 dest에 복사한다.
+ */
+#define __UNDS_SCAN_DISPATCH(op, ths, type, dest, result_of)                                  \
+    switch (type)                                                                             \
+    {                                                                                         \
+    case UNDS_SCAN_I8:                                                                        \
+    {                                                                                         \
+        result_of(int8_t, int64_t) r = __UNDS_SCAN_CALL(op, i8, (const int8_t*)ths->arr, ths->size);       \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_U8:                                                                        \
+    {                                                                                         \
+        result_of(uint8_t, uint64_t) r = __UNDS_SCAN_CALL(op, u8, (const uint8_t*)ths->arr, ths->size);    \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_I16:                                                                       \
+    {                                                                                         \
+        result_of(int16_t, int64_t) r = __UNDS_SCAN_CALL(op, i16, (const int16_t*)ths->arr, ths->size);    \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_U16:                                                                       \
+    {                                                                                         \
+        result_of(uint16_t, uint64_t) r = __UNDS_SCAN_CALL(op, u16, (const uint16_t*)ths->arr, ths->size); \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_I32:                                                                       \
+    {                                                                                         \
+        result_of(int32_t, int64_t) r = __UNDS_SCAN_CALL(op, i32, (const int32_t*)ths->arr, ths->size);    \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_U32:                                                                       \
+    {                                                                                         \
+        result_of(uint32_t, uint64_t) r = __UNDS_SCAN_CALL(op, u32, (const uint32_t*)ths->arr, ths->size); \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_I64:                                                                       \
+    {                                                                                         \
+        result_of(int64_t, int64_t) r = __UNDS_SCAN_CALL(op, i64, (const int64_t*)ths->arr, ths->size);    \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_U64:                                                                       \
+    {                                                                                         \
+        result_of(uint64_t, uint64_t) r = __UNDS_SCAN_CALL(op, u64, (const uint64_t*)ths->arr, ths->size); \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_F32:                                                                       \
+    {                                                                                         \
+        result_of(float, double) r = __UNDS_SCAN_CALL(op, f32, (const float*)ths->arr, ths->size);         \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    case UNDS_SCAN_F64:                                                                       \
+    {                                                                                         \
+        result_of(double, double) r = __UNDS_SCAN_CALL(op, f64, (const double*)ths->arr, ths->size);       \
+        memcpy(dest, &r, sizeof(r));                                                          \
+        break;                                                                                \
+    }                                                                                         \
+    }
+
+#define __UNDS_SCAN_ELEM_TYPE(elem_type, sum_type) elem_type
+#define __UNDS_SCAN_SUM_TYPE(elem_type, sum_type) sum_type
+
+/**
+ * *내부 함수
+ *
+ * @brief type의 크기가 리스트 단일 요소의 크기와 같은지 검사
+ * @param ths 대상 리스트 포인터
+ * @param type 요소의 자료형
+ * @param func 호출한 함수의 이름 (오류 메시지에 사용)
+ */
+void __unds_scan_check_type(unds_list_t* ths, unds_scan_type_t type, const char* func)
+{
+    static const size_t sizes[] = {1, 1, 2, 2, 4, 4, 8, 8, 4, 8};
+
+    if ((size_t)type >= sizeof(sizes) / sizeof(sizes[0]) || sizes[type] != ths->of_size)
+    {
+        fprintf(stderr, "stderr: Scan type does not match the element size %zu in %s().\n", ths->of_size, func);
+        abort();
+    }
+}
+
+void unds_list_min(unds_list_t* ths, unds_scan_type_t type, void* dest)
+{
+    __unds_scan_check_type(ths, type, "unds_list_min");
+
+    if (unds_list_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to find the minimum because the list is empty.\n");
+        abort();
+    }
+
+    __UNDS_SCAN_DISPATCH(min, ths, type, dest, __UNDS_SCAN_ELEM_TYPE);
+}
+
+void unds_list_max(unds_list_t* ths, unds_scan_type_t type, void* dest)
+{
+    __unds_scan_check_type(ths, type, "unds_list_max");
+
+    if (unds_list_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to find the maximum because the list is empty.\n");
+        abort();
+    }
+
+    __UNDS_SCAN_DISPATCH(max, ths, type, dest, __UNDS_SCAN_ELEM_TYPE);
+}
+
+void unds_list_sum(unds_list_t* ths, unds_scan_type_t type, void* dest)
+{
+    __unds_scan_check_type(ths, type, "unds_list_sum");
+
+    __UNDS_SCAN_DISPATCH(sum, ths, type, dest, __UNDS_SCAN_SUM_TYPE);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 원형 버퍼의 index부터 n개의 요소를 dest에 복사
+ * @param arr 원형 버퍼의 포인터
+ * @param capacity 원형 버퍼의 용량
+ * @param of_size 단일 요소의 크기
+ * @param index 복사를 시작할 인덱스
+ * @param dest 요소를 복사할 목적지
+ * @param n 복사할 요소의 개수
+ */
+void __unds_ring_copy_out(void* arr, size_t capacity, size_t of_size, size_t index, void* dest, size_t n)
+{
+    size_t index_to_end = capacity - index;
+
+    if (index_to_end >= n)
+        memcpy(dest, (char*)arr + index * of_size, n * of_size);
+    else
+    {
+        memcpy(dest, (char*)arr + index * of_size, index_to_end * of_size);
+        memcpy((char*)dest + index_to_end * of_size, arr, (n - index_to_end) * of_size);
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 배열의 n개의 요소를 원형 버퍼의 index부터 복사
+ * @param arr 원형 버퍼의 포인터
+ * @param capacity 원형 버퍼의 용량
+ * @param of_size 단일 요소의 크기
+ * @param index 복사를 시작할 인덱스
+ * @param src 복사할 배열의 포인터
+ * @param n 복사할 요소의 개수
+ */
+void __unds_ring_copy_in(void* arr, size_t capacity, size_t of_size, size_t index, void* src, size_t n)
+{
+    size_t index_to_end = capacity - index;
+
+    if (index_to_end >= n)
+        memcpy((char*)arr + index * of_size, src, n * of_size);
+    else
+    {
+        memcpy((char*)arr + index * of_size, src, index_to_end * of_size);
+        memcpy(arr, (char*)src + index_to_end * of_size, (n - index_to_end) * of_size);
+    }
+}
+
+/**
+ * *내부 함수
+ * 
+ * @brief 덱 크기 2배 증가
+ * @param ths 대상 덱 포인터
+ */
+void __unds_deque_double(unds_deque_t* ths)
+{
+    size_t old_capacity = ths->capacity;
+    size_t head = ths->head & (old_capacity - 1);
+
+    ths->capacity *= 2;
+    ths->arr = __unds_storage_realloc(ths->arr, ths->capacity * ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for deque in __unds_deque_double().\n");
+        abort();
+    }
+
+    // 앞으로 돌아간 부분을 기존 공간의 바로 뒤로 옮겨 요소가 연속되도록 한다.
+    if (head + ths->size > old_capacity)
+        memcpy((char*)ths->arr + old_capacity * ths->of_size, ths->arr, (head + ths->size - old_capacity) * ths->of_size);
+
+    ths->head = head;
+    ths->tail = head + ths->size;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 덱의 크기를 2의 제곱수로 교정
+ * @param ths 대상 덱 포인터
+ */
+void __unds_deque_capacity_correction(unds_deque_t* ths)
+{
+    size_t correct_capacity = 1;
+
+    while (correct_capacity < ths->size)
+        correct_capacity *= 2;
+
+    ths->arr = __unds_storage_realloc(ths->arr, correct_capacity * ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for deque in __unds_deque_capacity_correction().\n");
+        abort();
+    }
+
+    ths->capacity = correct_capacity;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 덱를 새로운 공간으로 옮기며 용량 변경
+ * @param ths 대상 덱 포인터
+ * @param capacity 변경할 용량
+ */
+void __unds_deque_resize(unds_deque_t* ths, size_t capacity)
+{
+    void* arr = __unds_storage_alloc(capacity * ths->of_size);
+    if (arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for deque in __unds_deque_resize().\n");
+        abort();
+    }
+
+    __unds_ring_copy_out(ths->arr, ths->capacity, ths->of_size, ths->head & (ths->capacity - 1), arr, ths->size);
+    __unds_storage_free(ths->arr);
+
+    ths->arr = arr;
+    ths->capacity = capacity;
+    ths->head = 0;
+    ths->tail = ths->size;
+}
+
+/**
+ * *내부 함수
+ * 
+ * @brief 덱 크기 2배 감소
+ * @param ths 대상 덱 포인터
+ */
+void __unds_deque_half(unds_deque_t* ths)
+{
+    __unds_deque_resize(ths, ths->capacity / 2);
+}
+
+unds_deque_t* unds_deque_create(size_t of_size)
+{
+    unds_deque_t* ths = (unds_deque_t*)unds_malloc(sizeof(unds_deque_t));
+
+    ths->arr = __unds_storage_alloc(of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for deque in unds_deque_create().\n");
+        abort();
+    }
+
+    ths->capacity = 1;
+    ths->size = 0;
+    ths->of_size = of_size;
+    ths->head = 0;
+    ths->tail = 0;
+
+    return ths;
+}
+
+unds_deque_t* unds_deque_create_from_array(void* arr, size_t size, size_t of_size)
+{
+    if (arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to initialize deque since the original array is NULL.\n");
+        abort();
+    }
+    else if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of deque cannot be zero.");
+        abort();
+    }
+
+    unds_deque_t* ths = (unds_deque_t*)unds_malloc(sizeof(unds_deque_t));
+
+    ths->arr = __unds_storage_alloc(size * of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for deque in unds_deque_create_from_array().\n");
+        abort();
+    }
+
+    ths->capacity = size;
+    ths->size = size;
+    ths->of_size = of_size;
+    ths->head = 0;
+    ths->tail = size;
+
+    memcpy(ths->arr, arr, size * of_size);
+    __unds_deque_capacity_correction(ths);
+
+    return ths;
+}
+
+unds_deque_t* unds_deque_create_from_value(void* value, size_t size, size_t of_size)
+{
+    if (value == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to initialize deque since the original array is NULL.\n");
+        abort();
+    }
+    else if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of deque cannot be zero.");
+        abort();
+    }
+
+    unds_deque_t* ths = (unds_deque_t*)unds_malloc(sizeof(unds_deque_t));
+    ths->arr = __unds_storage_alloc(size * of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for deque in unds_deque_create_from_array().\n");
+        abort();
+    }
+
+    ths->capacity = size;
+    ths->size = size;
+    ths->of_size = of_size;
+    ths->head = 0;
+    ths->tail = size;
+
+    for (size_t i = 0; i < size; i++)
+        memcpy((char*)ths->arr + i * of_size, value, of_size);
+    __unds_deque_capacity_correction(ths);
+    
+    return ths;
+}
+
+void unds_deque_delete(unds_deque_t* ths)
+{
+    __unds_storage_free(ths->arr);
+    unds_free(ths);
+}
+
+bool unds_deque_empty(unds_deque_t* ths)
+{
+    return ths->size == 0;
+}
+
+void unds_deque_push_front(unds_deque_t* ths, void* value)
+{
+    if (ths->size == ths->capacity)
+        __unds_deque_double(ths);
+
+    ths->head--;
+    memcpy((char*)ths->arr + (ths->head & (ths->capacity - 1)) * ths->of_size, value, ths->of_size);
+
+    ths->size++;
+}
+
+void unds_deque_push_back(unds_deque_t* ths, void* value)
+{
+    if (ths->size == ths->capacity)
+        __unds_deque_double(ths);
+
+    memcpy((char*)ths->arr + (ths->tail & (ths->capacity - 1)) * ths->of_size, value, ths->of_size);
+    ths->tail++;
+
+    ths->size++;
+}
+
+void unds_deque_pop_front(unds_deque_t* ths)
+{
+    if (unds_deque_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop an element from deque because the deque is empty.\n");
+        abort();
+    }
+
+    ths->head++;
+    ths->size--;
+
+    if (ths->capacity > 1 && ths->size == ths->capacity / 4)
+        __unds_deque_half(ths);
+}
+
+void unds_deque_pop_back(unds_deque_t* ths)
+{
+    if (unds_deque_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop an element from deque because the deque is empty.\n");
+        abort();
+    }
+
+    ths->tail--;
+    ths->size--;
+
+    if (ths->capacity > 1 && ths->size == ths->capacity / 4)
+        __unds_deque_half(ths);
+}
+
+void unds_deque_front(unds_deque_t* ths, void* dest)
+{
+    if (unds_deque_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to read from the front of the deque because the deque is empty.\n");
+        abort();
+    }
+
+    memcpy(dest, (char*)ths->arr + (ths->head & (ths->capacity - 1)) * ths->of_size, ths->of_size);
+}
+
+void unds_deque_back(unds_deque_t* ths, void* dest)
+{
+    if (unds_deque_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to read from the back of the deque because the deque is empty.\n");
+        abort();
+    }
+
+    memcpy(dest, (char*)ths->arr + ((ths->tail - 1) & (ths->capacity - 1)) * ths->of_size, ths->of_size);
+}
+
+void unds_deque_clear(unds_deque_t* ths)
+{
+    ths->arr = __unds_storage_realloc(ths->arr, ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for stack in deque_clear().\n");
+        abort();
+    }
+
+    ths->capacity = 1;
+    ths->size = 0;
+    ths->head = 0;
+    ths->tail = 0;
+}
+
+void unds_deque_reserve(unds_deque_t* ths, size_t capacity)
+{
+    if (capacity <= ths->capacity)
+        return;
+
+    size_t correct_capacity = __unds_grow_capacity(ths->capacity, capacity, ths->of_size, "unds_deque_reserve");
+
+    __unds_deque_resize(ths, correct_capacity);
+}
+
+void unds_deque_shrink_to_fit(unds_deque_t* ths)
+{
+    size_t correct_capacity = 1;
+
+    while (correct_capacity < ths->size)
+        correct_capacity *= 2;
+
+    if (correct_capacity < ths->capacity)
+        __unds_deque_resize(ths, correct_capacity);
+}
+
+void unds_deque_push_front_n(unds_deque_t* ths, void* arr, size_t n)
+{
+    unds_deque_reserve(ths, ths->size + n);
+
+    ths->head -= n;
+    __unds_ring_copy_in(ths->arr, ths->capacity, ths->of_size, ths->head & (ths->capacity - 1), arr, n);
+
+    ths->size += n;
+}
+
+void unds_deque_push_back_n(unds_deque_t* ths, void* arr, size_t n)
+{
+    unds_deque_reserve(ths, ths->size + n);
+
+    __unds_ring_copy_in(ths->arr, ths->capacity, ths->of_size, ths->tail & (ths->capacity - 1), arr, n);
+    ths->tail += n;
+
+    ths->size += n;
+}
+
+void unds_deque_pop_front_n(unds_deque_t* ths, void* dest, size_t n)
+{
+    if (n > ths->size)
+    {
+        fprintf(stderr, "stderr: Failed to pop %zu elements from deque because the deque has only %zu.\n", n, ths->size);
+        abort();
+    }
+
+    if (dest != NULL)
+        __unds_ring_copy_out(ths->arr, ths->capacity, ths->of_size, ths->head & (ths->capacity - 1), dest, n);
+
+    ths->head += n;
+    ths->size -= n;
+
+    if (ths->size > 0 && ths->size <= ths->capacity / 4)
+        unds_deque_shrink_to_fit(ths);
+}
+
+void unds_deque_pop_back_n(unds_deque_t* ths, void* dest, size_t n)
+{
+    if (n > ths->size)
+    {
+        fprintf(stderr, "stderr: Failed to pop %zu elements from deque because the deque has only %zu.\n", n, ths->size);
+        abort();
+    }
+
+    ths->tail -= n;
+
+    if (dest != NULL)
+        __unds_ring_copy_out(ths->arr, ths->capacity, ths->of_size, ths->tail & (ths->capacity - 1), dest, n);
+
+    ths->size -= n;
+
+    if (ths->size > 0 && ths->size <= ths->capacity / 4)
+        unds_deque_shrink_to_fit(ths);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 보관 중인 빈 청크를 꺼내거나 새 청크 할당
+ * @param ths 대상 덱 포인터
+ * @return 청크의 주소
+ */
+void* __unds_segmented_deque_chunk_alloc(unds_segmented_deque_t* ths)
+{
+    if (ths->num_spare > 0)
+        return ths->spare[--ths->num_spare];
+
+    void* chunk = unds_malloc(ths->chunk_size * ths->of_size);
+    if (chunk == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for chunk in __unds_segmented_deque_chunk_alloc().\n");
+        abort();
+    }
+
+    return chunk;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 빈 청크를 재사용을 위해 보관하거나 해제
+ * @param ths 대상 덱 포인터
+ * @param chunk 청크의 주소
+ */
+void __unds_segmented_deque_chunk_release(unds_segmented_deque_t* ths, void* chunk)
+{
+    if (ths->num_spare < __UNDS_SEGMENTED_DEQUE_SPARE)
+        ths->spare[ths->num_spare++] = chunk;
+    else
+        unds_free(chunk);
+}
+
+/**
+ * *내부 함수
+ *
+ * 청크 포인터만 옮기므로 요소는 복사되지 않는다.
+ *
+ * @brief 맵을 새로운 용량으로 옮김
+ * @param ths 대상 덱 포인터
+ * @param map_capacity 변경할 맵의 용량 (사용 중인 청크의 개수 이상인 2의 제곱수)
+ */
+void __unds_segmented_deque_resize_map(unds_segmented_deque_t* ths, size_t map_capacity)
+{
+    void** map = (void**)unds_malloc(map_capacity * sizeof(void*));
+    if (map == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for map in __unds_segmented_deque_resize_map().\n");
+        abort();
+    }
+
+    for (size_t i = 0; i < ths->num_chunks; i++)
+        map[i] = ths->map[(ths->map_head + i) & (ths->map_capacity - 1)];
+
+    unds_free(ths->map);
+
+    ths->map = map;
+    ths->map_capacity = map_capacity;
+    ths->map_head = 0;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 사용 중인 모든 청크를 반환하고 빈 상태로 초기화
+ * @param ths 대상 덱 포인터
+ */
+void __unds_segmented_deque_release_all(unds_segmented_deque_t* ths)
+{
+    for (size_t i = 0; i < ths->num_chunks; i++)
+        __unds_segmented_deque_chunk_release(ths, ths->map[(ths->map_head + i) & (ths->map_capacity - 1)]);
+
+    ths->num_chunks = 0;
+    ths->map_head = 0;
+    ths->front = 0;
+    ths->size = 0;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief index번째 요소의 주소 계산 (범위 검사 없음)
+ * @param ths 대상 덱 포인터
+ * @param index 요소의 위치
+ * @return 요소의 주소
+ */
+char* __unds_segmented_deque_elem(unds_segmented_deque_t* ths, size_t index)
+{
+    size_t pos = ths->front + index;
+    char* chunk = (char*)ths->map[(ths->map_head + (pos >> ths->chunk_shift)) & (ths->map_capacity - 1)];
+
+    return chunk + (pos & (ths->chunk_size - 1)) * ths->of_size;
+}
+
+unds_segmented_deque_t* unds_segmented_deque_create(size_t of_size)
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of deque cannot be zero.\n");
+        abort();
+    }
+
+    unds_segmented_deque_t* ths = (unds_segmented_deque_t*)unds_malloc(sizeof(unds_segmented_deque_t));
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for deque in unds_segmented_deque_create().\n");
+        abort();
+    }
+
+    ths->map = (void**)unds_malloc(sizeof(void*));
+    if (ths->map == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for map in unds_segmented_deque_create().\n");
+        abort();
+    }
+
+    ths->map_capacity = 1;
+    ths->map_head = 0;
+    ths->num_chunks = 0;
+    ths->front = 0;
+    ths->size = 0;
+    ths->of_size = of_size;
+    ths->chunk_size = 1;
+    ths->chunk_shift = 0;
+    ths->num_spare = 0;
+
+    while (ths->chunk_size * 2 * of_size <= UNDS_SEGMENTED_DEQUE_CHUNK_BYTES)
+    {
+        ths->chunk_size *= 2;
+        ths->chunk_shift++;
+    }
+
+    return ths;
+}
+
+unds_segmented_deque_t* unds_segmented_deque_create_from_array(void* arr, size_t size, size_t of_size)
+{
+    if (arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to initialize deque since the original array is NULL.\n");
+        abort();
+    }
+
+    unds_segmented_deque_t* ths = unds_segmented_deque_create(of_size);
+    unds_segmented_deque_push_back_n(ths, arr, size);
+
+    return ths;
+}
+
+unds_segmented_deque_t* unds_segmented_deque_create_from_value(void* value, size_t size, size_t of_size)
+{
+    if (value == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to initialize deque since the original array is NULL.\n");
+        abort();
+    }
+
+    unds_segmented_deque_t* ths = unds_segmented_deque_create(of_size);
+
+    for (size_t i = 0; i < size; i++)
+        unds_segmented_deque_push_back(ths, value);
+
+    return ths;
+}
+
+void unds_segmented_deque_delete(unds_segmented_deque_t* ths)
+{
+    for (size_t i = 0; i < ths->num_chunks; i++)
+        unds_free(ths->map[(ths->map_head + i) & (ths->map_capacity - 1)]);
+    for (size_t i = 0; i < ths->num_spare; i++)
+        unds_free(ths->spare[i]);
+
+    unds_free(ths->map);
+    unds_free(ths);
+}
+
+bool unds_segmented_deque_empty(unds_segmented_deque_t* ths)
+{
+    return ths->size == 0;
+}
+
+void unds_segmented_deque_push_front(unds_segmented_deque_t* ths, void* value)
+{
+    if (ths->front == 0)
+    {
+        if (ths->num_chunks == ths->map_capacity)
+            __unds_segmented_deque_resize_map(ths, ths->map_capacity * 2);
+
+        ths->map_head = (ths->map_head + ths->map_capacity - 1) & (ths->map_capacity - 1);
+        ths->map[ths->map_head] = __unds_segmented_deque_chunk_alloc(ths);
+        ths->num_chunks++;
+        ths->front = ths->chunk_size;
+    }
+
+    ths->front--;
+    ths->size++;
+
+    memcpy(__unds_segmented_deque_elem(ths, 0), value, ths->of_size);
+}
+
+void unds_segmented_deque_push_back(unds_segmented_deque_t* ths, void* value)
+{
+    if (ths->front + ths->size == ths->num_chunks << ths->chunk_shift)
+    {
+        if (ths->num_chunks == ths->map_capacity)
+            __unds_segmented_deque_resize_map(ths, ths->map_capacity * 2);
+
+        ths->map[(ths->map_head + ths->num_chunks) & (ths->map_capacity - 1)] = __unds_segmented_deque_chunk_alloc(ths);
+        ths->num_chunks++;
+    }
+
+    memcpy(__unds_segmented_deque_elem(ths, ths->size), value, ths->of_size);
+    ths->size++;
+}
+
+void unds_segmented_deque_pop_front(unds_segmented_deque_t* ths)
+{
+    if (unds_segmented_deque_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop an element from the front of the deque because the deque is empty.\n");
+        abort();
+    }
+
+    ths->front++;
+    ths->size--;
+
+    if (ths->size == 0)
+        __unds_segmented_deque_release_all(ths);
+    else if (ths->front == ths->chunk_size)
+    {
+        __unds_segmented_deque_chunk_release(ths, ths->map[ths->map_head]);
+        ths->map_head = (ths->map_head + 1) & (ths->map_capacity - 1);
+        ths->num_chunks--;
+        ths->front = 0;
+    }
+}
+
+void unds_segmented_deque_pop_back(unds_segmented_deque_t* ths)
+{
+    if (unds_segmented_deque_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop an element from the back of the deque because the deque is empty.\n");
+        abort();
+    }
+
+    ths->size--;
+
+    if (ths->size == 0)
+        __unds_segmented_deque_release_all(ths);
+    else if (ths->front + ths->size <= (ths->num_chunks - 1) << ths->chunk_shift)
+    {
+        ths->num_chunks--;
+        __unds_segmented_deque_chunk_release(ths, ths->map[(ths->map_head + ths->num_chunks) & (ths->map_capacity - 1)]);
+    }
+}
+
+void unds_segmented_deque_front(unds_segmented_deque_t* ths, void* dest)
+{
+    if (unds_segmented_deque_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to read from the front of the deque because the deque is empty.\n");
+        abort();
+    }
+
+    memcpy(dest, __unds_segmented_deque_elem(ths, 0), ths->of_size);
+}
+
+void unds_segmented_deque_back(unds_segmented_deque_t* ths, void* dest)
+{
+    if (unds_segmented_deque_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to read from the back of the deque because the deque is empty.\n");
+        abort();
+    }
+
+    memcpy(dest, __unds_segmented_deque_elem(ths, ths->size - 1), ths->of_size);
+}
+
+void* unds_segmented_deque_at(unds_segmented_deque_t* ths, size_t index)
+{
+    if (index >= ths->size)
+    {
+        fprintf(stderr, "stderr: Deque index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        abort();
+    }
+
+    return __unds_segmented_deque_elem(ths, index);
+}
+
+void unds_segmented_deque_get(unds_segmented_deque_t* ths, void* dest, size_t index)
+{
+    memcpy(dest, unds_segmented_deque_at(ths, index), ths->of_size);
+}
+
+void unds_segmented_deque_set(unds_segmented_deque_t* ths, size_t index, void* value)
+{
+    memcpy(unds_segmented_deque_at(ths, index), value, ths->of_size);
+}
+
+void unds_segmented_deque_clear(unds_segmented_deque_t* ths)
+{
+    __unds_segmented_deque_release_all(ths);
+}
+
+void unds_segmented_deque_shrink_to_fit(unds_segmented_deque_t* ths)
+{
+    for (size_t i = 0; i < ths->num_spare; i++)
+        unds_free(ths->spare[i]);
+    ths->num_spare = 0;
+
+    size_t map_capacity = 1;
+
+    while (map_capacity < ths->num_chunks)
+        map_capacity *= 2;
+
+    if (map_capacity < ths->map_capacity)
+        __unds_segmented_deque_resize_map(ths, map_capacity);
+}
+
+void unds_segmented_deque_push_back_n(unds_segmented_deque_t* ths, void* arr, size_t n)
+{
+    const char* src = (const char*)arr;
+
+    while (n > 0)
+    {
+        size_t pos = ths->front + ths->size;
+
+        if (pos == ths->num_chunks << ths->chunk_shift)
+        {
+            if (ths->num_chunks == ths->map_capacity)
+                __unds_segmented_deque_resize_map(ths, ths->map_capacity * 2);
+
+            ths->map[(ths->map_head + ths->num_chunks) & (ths->map_capacity - 1)] = __unds_segmented_deque_chunk_alloc(ths);
+            ths->num_chunks++;
+        }
+
+        // 마지막 청크에 남은 자리만큼 한 번에 복사한다.
+        size_t room = ths->chunk_size - (pos & (ths->chunk_size - 1));
+        size_t count = n < room ? n : room;
+
+        memcpy(__unds_segmented_deque_elem(ths, ths->size), src, count * ths->of_size);
+
+        ths->size += count;
+        src += count * ths->of_size;
+        n -= count;
+    }
+}
+
+void unds_segmented_deque_pop_front_n(unds_segmented_deque_t* ths, void* dest, size_t n)
+{
+    if (n > ths->size)
+    {
+        fprintf(stderr, "stderr: Failed to pop %zu elements from deque because the deque has only %zu.\n", n, ths->size);
+        abort();
+    }
+
+    char* out = (char*)dest;
+
+    while (n > 0)
+    {
+        // 첫 청크에 남은 요소만큼 한 번에 복사한다.
+        size_t left = ths->chunk_size - ths->front;
+        size_t count = n < left ? n : left;
+
+        if (out != NULL)
+        {
+            memcpy(out, __unds_segmented_deque_elem(ths, 0), count * ths->of_size);
+            out += count * ths->of_size;
+        }
+
+        ths->front += count;
+        ths->size -= count;
+        n -= count;
+
+        if (ths->size == 0)
+            __unds_segmented_deque_release_all(ths);
+        else if (ths->front == ths->chunk_size)
+        {
+            __unds_segmented_deque_chunk_release(ths, ths->map[ths->map_head]);
+            ths->map_head = (ths->map_head + 1) & (ths->map_capacity - 1);
+            ths->num_chunks--;
+            ths->front = 0;
+        }
+    }
+}
+
+unds_hash_map_t* unds_hash_map_create(size_t of_size_key, size_t of_size_value, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q));
+
+/**
+ * *내부 함수
+ *
+ * @brief 해시맵의 크기를 두 배로 증가
+ * @param ths 대상 해시맵 포인터
+ */
+void __unds_hash_map_double(unds_hash_map_t* ths)
+{
+    unds_list_t** delete_arr = ths->arr;
+
+    ths->capacity *= 2;
+    ths->size = 0;
+
+    ths->arr = (unds_list_t**)__unds_storage_alloc(ths->capacity * sizeof(unds_list_t*));
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for hash map in __hash_map_double()\n");
+        abort();
+    }
+
+    for (size_t i = 0; i < ths->capacity; i++)
+        ths->arr[i] = unds_list_create(sizeof(unds_pair_t*));
+
+    for (size_t i = 0; i < ths->capacity / 2; i++)
+    {
+        for (size_t j = 0; j < delete_arr[i]->size; j++)
+        {
+            unds_pair_t* pair;
+            unds_list_get(delete_arr[i], &pair, j);
+            unds_hash_map_push(ths, pair->first, pair->second);
+            unds_pair_delete(pair);
+        }
+        unds_list_delete(delete_arr[i]);
+    }
+    __unds_storage_free(delete_arr);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 해시맵의 크기를 반으로 감소
+ * @param ths 대상 해시맵 포인터
+ */
+void __unds_hash_map_half(unds_hash_map_t* ths)
+{
+    unds_list_t** delete_arr = ths->arr;
+
+    ths->capacity /= 2;
+    ths->size = 0;
+
+    ths->arr = (unds_list_t**)__unds_storage_alloc(ths->capacity * sizeof(unds_list_t*));
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for hash map in __hash_map_half()\n");
+        abort();
+    }
+
+    for (size_t i = 0; i < ths->capacity; i++)
+        ths->arr[i] = unds_list_create(sizeof(unds_pair_t*));
+
+    for (size_t i = 0; i < ths->capacity * 2; i++)
+    {
+        for (size_t j = 0; j < delete_arr[i]->size; j++)
+        {
+            unds_pair_t* pair;
+            unds_list_get(delete_arr[i], &pair, j);
+            unds_hash_map_push(ths, pair->first, pair->second);
+            unds_pair_delete(pair);
+        }
+        unds_list_delete(delete_arr[i]);
+    }
+    __unds_storage_free(delete_arr);
+}
+
+unds_hash_map_t* unds_hash_map_create(size_t of_size_key, size_t of_size_value, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q))
+{
+    unds_hash_map_t* ths = (unds_hash_map_t*)unds_malloc(sizeof(unds_hash_map_t));
+
+    ths->arr = (unds_list_t**)__unds_storage_alloc(21 * sizeof(unds_list_t*));
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for hash map in hash_map_create()\n");
+        abort();
+    }
+
+    for (int i = 0; i < 21; i++)
+        ths->arr[i] = unds_list_create(sizeof(unds_pair_t*));
+
+    ths->capacity = 21;
+    ths->size = 0;
+    ths->of_size_key = of_size_key;
+    ths->of_size_value = of_size_value;
+
+    ths->hash = hash;
+    ths->comp = comp;
+
+    return ths;
+}
+
+void unds_hash_map_delete(unds_hash_map_t* ths)
+{
+    for (size_t i = 0; i < ths->capacity; i++)
+    {
+        for (size_t j = 0; j < ths->arr[i]->size; j++)
+            unds_pair_delete(((unds_pair_t**)ths->arr[i]->arr)[j]);
+        unds_list_delete(ths->arr[i]);
+    }
+    __unds_storage_free(ths->arr);
+    unds_free(ths);
+}
+
+float unds_hash_map_get_load_factor(unds_hash_map_t* ths)
+{
+    return (float)ths->size / ths->capacity;
+}
+
+void unds_hash_map_push(unds_hash_map_t* ths, void* key, void* value)
+{
+    if (unds_hash_map_get_load_factor(ths) > 0.7)
+        __unds_hash_map_double(ths);
+
+    size_t index = ths->hash(key) % ths->capacity;
+
+    for (size_t i = 0; i < ths->arr[index]->size; i++)
+    {
+        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
+        if (ths->comp(key, pair->first) == 0)
+        {
+            return;
+        }
+    }
+
+    unds_pair_t* pair = unds_pair_make(key, ths->of_size_key, value, ths->of_size_value);
+    unds_list_push(ths->arr[index], &pair);
+
+    ths->size++;
+}
+
+void unds_hash_map_pop(unds_hash_map_t* ths, void* key)
+{
+    size_t index = ths->hash(key) % ths->capacity;
+
+    for (size_t i = 0; i < ths->arr[index]->size; i++)
+    {
+        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
+        if (ths->comp(key, pair->first) == 0)
+        {
+            unds_pair_delete(pair);
+            unds_list_remove(ths->arr[index], i);
+            ths->size--;
+
+            if (ths->capacity > 21 && unds_hash_map_get_load_factor(ths) < 0.3)
+                __unds_hash_map_half(ths);
+
+            return;
+        }
+    }
+
+    fprintf(stderr, "stderr: Failed to pop an element from hash map because key is invalid.\n");
+    abort();
+}
+
+void unds_hash_map_get(unds_hash_map_t* ths, void* dest, void* key)
+{
+    size_t index = ths->hash(key) % ths->capacity;
+
+    for (size_t i = 0; i < ths->arr[index]->size; i++)
+    {
+        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
+        if (ths->comp(key, pair->first) == 0)
+        {
+            memcpy(dest, pair->second, ths->of_size_value);
+            return;
+        }
+    }
+
+    fprintf(stderr, "stderr: Failed to read an element from hash map because key is invalid.\n");
+    abort();
+}
+
+void unds_hash_map_set(unds_hash_map_t* ths, void* key, void* value)
+{
+    size_t index = ths->hash(key) % ths->capacity;
+
+    for (size_t i = 0; i < ths->arr[index]->size; i++)
+    {
+        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
+        if (ths->comp(key, pair->first) == 0)
+        {
+            unds_pair_set_second(pair, value);
+            return;
+        }
+    }
+
+    fprintf(stderr, "stderr: Failed to set an element in hash map because key is invalid.\n");
+    abort();
+}
+
+bool unds_hash_map_has(unds_hash_map_t* ths, void* key)
+{
+    size_t index = ths->hash(key) % ths->capacity;
+
+    for (size_t i = 0; i < ths->arr[index]->size; i++)
+    {
+        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
+        if (ths->comp(key, pair->first) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+void unds_hash_map_clear(unds_hash_map_t* ths)
+{
+    for (size_t i = 0; i < ths->capacity; i++)
+    {
+        size_t iter = ths->arr[i]->size;
+        for (size_t j = 0; j < iter; j++)
+        {
+            unds_pair_t* pair = ((unds_pair_t**)ths->arr[i]->arr)[j];
+            unds_hash_map_pop(ths, pair->first);
+        }
+    }
+}
+
+/**
+ * *내부 변수.
+ *
+ * 내부 true
+ */
+bool __unds_true = true;
+/**
+ * *내부 변수.
+ *
+ * 내부 false
+ */
+bool __unds_false = false;
+
+/**
+ * *내부 함수.
+ * 
+ * @brief 해시셋의 속성을 해시맵과 동기화
+ * @param ths 대상 해시셋 포인터
+ */
+void __unds_hash_set_update_variables(unds_hash_set_t* ths)
+{
+    ths->capacity = ths->map->capacity;
+    ths->size = ths->map->size;
+    ths->of_size = ths->map->of_size_key;
+
+    ths->hash = ths->map->hash;
+    ths->comp = ths->map->comp;
+}
+
+unds_hash_set_t* unds_hash_set_create(size_t of_size, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q))
+{
+    unds_hash_set_t* ths = (unds_hash_set_t*)unds_malloc(sizeof(unds_hash_set_t));
+
+    ths->map = unds_hash_map_create(of_size, sizeof(bool), hash, comp);
+
+    __unds_hash_set_update_variables(ths);
+
+    return ths;
+}
+
+void unds_hash_set_delete(unds_hash_set_t* ths)
+{
+    unds_hash_map_delete(ths->map);
+    unds_free(ths);
+}
+
+void unds_hash_set_push(unds_hash_set_t* ths, void* elem)
+{
+    unds_hash_map_push(ths->map, elem, &__unds_true);
+
+    __unds_hash_set_update_variables(ths);
+}
+
+void unds_hash_set_pop(unds_hash_set_t* ths, void* elem)
+{
+    unds_hash_map_pop(ths->map, elem);
+
+    __unds_hash_set_update_variables(ths);
+}
+
+bool unds_hash_set_has(unds_hash_set_t* ths, void* elem)
+{
+    return unds_hash_map_has(ths->map, elem);
+}
+
+void unds_hash_set_clear(unds_hash_set_t* ths)
+{
+    unds_hash_map_clear(ths->map);
+
+    __unds_hash_set_update_variables(ths);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 힙큐 크기 2배 증가
+ * @param ths 대상 힙큐 포인터
+ */
+void __unds_heap_queue_double(unds_heap_queue_t* ths)
+{
+    ths->capacity *= 2;
+    ths->arr = __unds_storage_realloc(ths->arr, ths->capacity * ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for heap_queue in __heap_queue_double().\n");
+        abort();
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 힙큐 크기 2배 감소
+ * @param ths 대상 힙큐 포인터
+ */
+void __unds_heap_queue_half(unds_heap_queue_t* ths)
+{
+    if (ths->size == 0)
+        return;
+
+    ths->capacity /= 2;
+    ths->arr = __unds_storage_realloc(ths->arr, ths->capacity * ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for heap_queue in __heap_queue_half().\n");
+        abort();
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 힙큐의 크기를 2의 제곱수로 교정
+ * @param ths 대상 힙큐 포인터
+ */
+void __unds_heap_queue_capacity_correction(unds_heap_queue_t* ths)
+{
+    size_t correct_capacity = 1;
+
+    while (correct_capacity <= ths->size)
+        correct_capacity *= 2;
+
+    ths->arr = __unds_storage_realloc(ths->arr, correct_capacity * ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for stack in __heap_queue_capacity_correction().\n");
+        abort();
+    }
+
+    ths->capacity = correct_capacity;
+}
+
+/**
+ * *내부 함수
+ * 
+ * @brief 특정 인덱스에 대한 왼쪽 자식 요소의 인덱스 계산
+ * @param index 왼쪽 자식 요소를 계산할 부모 요소의 인덱스
+ * @return 왼쪽 자식 요소의 인덱스
+ */
+size_t __unds_heap_queue_get_left_child(size_t index)
+{
+    return 2 * index + 1;
+}
+
+/**
+ * *내부 함수
+ * 
+ * @brief 특정 인덱스에 대한 부모 요소의 인덱스 계산
+ * @param index 부모 요소를 계산할 자식 요소의 인덱스
+ * @return 부모 요소의 인덱스
+ */
+size_t __unds_heap_queue_get_parent(size_t index)
+{
+    if (index == 0)
+        return 0;
+    return (index - 1) / 2;
+}
+
+/**
+ * *내부 함수
+ * 
+ * @brief 특정 요소에 대해서 최상위 노드 방향으로 힙큐의 배열을 힙으로 변환
+ * @param ths 대상 힙큐 포인터
+ * @param index 힙으로 변환할 기준이 되는 요소의 인덱스
+ */
+void __unds_heap_queue_reheap_up(unds_heap_queue_t* ths, size_t index)
+{
+    char* base = (char*)ths->arr;
+    size_t of_size = ths->of_size;
+    size_t node = index;
+
+    if (node == 0 || ths->comp(base + node * of_size, base + __unds_heap_queue_get_parent(node) * of_size) >= 0)
+        return;
+
+    // 요소를 한 번만 꺼내 두고 부모들을 아래로 내린 뒤 빈자리에 넣는다.
+    union __unds_sort_small_temp_t small_temp;
+    char* temp = of_size <= sizeof(small_temp.buffer) ? small_temp.buffer : (char*)unds_malloc(of_size);
+    if (temp == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for heap queue in __unds_heap_queue_reheap_up().\n");
+        abort();
+    }
+
+    memcpy(temp, base + node * of_size, of_size);
+
+    while (node > 0)
+    {
+        size_t parent = __unds_heap_queue_get_parent(node);
+        if (ths->comp(temp, base + parent * of_size) >= 0)
+            break;
+
+        memcpy(base + node * of_size, base + parent * of_size, of_size);
+        node = parent;
+    }
+
+    memcpy(base + node * of_size, temp, of_size);
+
+    if (temp != small_temp.buffer)
+        unds_free(temp);
+}
+
+/**
+ * *내부 함수
+ * 
+ * @brief 특정 요소에 대해서 최하위 노드 방향으로 힙큐의 배열을 힙으로 변환
+ * @param ths 대상 힙큐 포인터
+ * @param index 힙으로 변환할 기준이 되는 요소의 인덱스
+ */
+void __unds_heap_queue_reheap_down(unds_heap_queue_t* ths, size_t index)
+{
+    char* base = (char*)ths->arr;
+    size_t of_size = ths->of_size;
+    size_t node = index;
+    size_t child = __unds_heap_queue_get_left_child(node);
+
+    if (child >= ths->size)
+        return;
+
+    // 요소를 한 번만 꺼내 두고 자식들을 위로 올린 뒤 빈자리에 넣는다.
+    union __unds_sort_small_temp_t small_temp;
+    char* temp = of_size <= sizeof(small_temp.buffer) ? small_temp.buffer : (char*)unds_malloc(of_size);
+    if (temp == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for heap queue in __unds_heap_queue_reheap_down().\n");
+        abort();
+    }
+
+    memcpy(temp, base + node * of_size, of_size);
+
+    while (child < ths->size)
+    {
+        size_t higher_priority = child;
+        if (child + 1 < ths->size && ths->comp(base + child * of_size, base + (child + 1) * of_size) >= 0)
+            higher_priority = child + 1;
+
+        if (ths->comp(base + higher_priority * of_size, temp) >= 0)
+            break;
+
+        memcpy(base + node * of_size, base + higher_priority * of_size, of_size);
+        node = higher_priority;
+        child = __unds_heap_queue_get_left_child(node);
+    }
+
+    memcpy(base + node * of_size, temp, of_size);
+
+    if (temp != small_temp.buffer)
+        unds_free(temp);
+}
+
+unds_heap_queue_t* unds_heap_queue_create(size_t of_size, int (*comp)(const void* p, const void* q))
+{
+    unds_heap_queue_t* ths = (unds_heap_queue_t*)unds_malloc(sizeof(unds_heap_queue_t));
+
+    ths->arr = __unds_storage_alloc(of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for heap queue in heap_queue_create()\n");
+        abort();
+    }
+
+    ths->capacity = 1;
+    ths->size = 0;
+    ths->of_size = of_size;
+    ths->comp = comp;
+
+    return ths;
+}
+
+unds_heap_queue_t* unds_heap_queue_create_from_array(void* arr, size_t size, size_t of_size, int (*comp)(const void* p, const void* q))
+{
+    if (arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to initialize heap_queue since the original array is NULL.\n");
+        abort();
+    }
+    else if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of heap_queue cannot be zero.");
+        abort();
+    }
+
+    unds_heap_queue_t* ths = (unds_heap_queue_t*)unds_malloc(sizeof(unds_heap_queue_t));
+
+    ths->arr = __unds_storage_alloc(size * of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for heap_queue in heap_queue_create_from_array().\n");
+        abort();
+    }
+
+    ths->capacity = size;
+    ths->size = size;
+    ths->of_size = of_size;
+    ths->comp = comp;
+
+    memcpy(ths->arr, arr, size * of_size);
+    __unds_heap_queue_capacity_correction(ths);
+    unds_heap_queue_heapify(ths);
+
+    return ths;
+}
+
+unds_heap_queue_t* unds_heap_queue_create_from_value(void* value, size_t size, size_t of_size, int (*comp)(const void* p, const void* q))
+{
+    if (value == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to initialize heap_queue since the original array is NULL.\n");
+        abort();
+    }
+    else if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of heap_queue cannot be zero.");
+        abort();
+    }
+
+    unds_heap_queue_t* ths = (unds_heap_queue_t*)unds_malloc(sizeof(unds_heap_queue_t));
+    ths->arr = __unds_storage_alloc(size * of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for heap_queue in heap_queue_create_from_array().\n");
+        abort();
+    }
+
+    ths->capacity = size;
+    ths->size = size;
+    ths->of_size = of_size;
+    ths->comp = comp;
+
+    for (size_t i = 0; i < size; i++)
+        memcpy((char*)ths->arr + i * of_size, value, of_size);
+    __unds_heap_queue_capacity_correction(ths);
+    
+    return ths;
+}
+
+void unds_heap_queue_delete(unds_heap_queue_t* ths)
+{
+    __unds_storage_free(ths->arr);
+    unds_free(ths);
+}
+
+bool unds_heap_queue_empty(unds_heap_queue_t* ths)
+{
+    return ths->size == 0;
+}
+
+void unds_heap_queue_push(unds_heap_queue_t* ths, void* value)
+{
+    if (ths->size == ths->capacity)
+        __unds_heap_queue_double(ths);
+
+    memcpy((char*)ths->arr + ths->size * ths->of_size, value, ths->of_size);
+    __unds_heap_queue_reheap_up(ths, ths->size);
+
+    ths->size++;
+}
+
+void unds_heap_queue_pop(unds_heap_queue_t* ths)
+{
+    if (unds_heap_queue_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop an element from heap queue because the heap queue is empty.\n");
+        abort();
+    }
+
+    ths->size--;
+
+    memcpy(ths->arr, (char*)ths->arr + ths->size * ths->of_size, ths->of_size);
+    __unds_heap_queue_reheap_down(ths, 0);
+
+    if (ths->size == ths->capacity / 2)
+        __unds_heap_queue_half(ths);
+}
+
+void unds_heap_queue_front(unds_heap_queue_t* ths, void* dest)
+{
+    if (unds_heap_queue_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to read from the front of the heap queue because the heap queue is empty.\n");
+        abort();
+    }
+
+    memcpy(dest, ths->arr, ths->of_size);
+}
+
+void unds_heap_queue_clear(unds_heap_queue_t* ths)
+{
+    ths->arr = __unds_storage_realloc(ths->arr, ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for stack in heap_queue_clear().\n");
+        abort();
+    }
+
+    ths->capacity = 1;
+    ths->size = 0;
+}
+
+void unds_heap_queue_reserve(unds_heap_queue_t* ths, size_t capacity)
+{
+    if (capacity <= ths->capacity)
+        return;
+
+    size_t correct_capacity = __unds_grow_capacity(ths->capacity, capacity, ths->of_size, "unds_heap_queue_reserve");
+
+    ths->arr = __unds_storage_realloc(ths->arr, correct_capacity * ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for heap_queue in unds_heap_queue_reserve().\n");
+        abort();
+    }
+
+    ths->capacity = correct_capacity;
+}
+
+void unds_heap_queue_shrink_to_fit(unds_heap_queue_t* ths)
+{
+    __unds_heap_queue_capacity_correction(ths);
+}
+
+void unds_heap_queue_push_n(unds_heap_queue_t* ths, void* arr, size_t n)
+{
+    unds_heap_queue_reserve(ths, ths->size + n);
+
+    memcpy((char*)ths->arr + ths->size * ths->of_size, arr, n * ths->of_size);
+
+    // 기존 요소보다 많이 삽입하면 전체를 다시 힙으로 만드는 편이 빠르다.
+    if (n > ths->size)
+    {
+        ths->size += n;
+        unds_heap_queue_heapify(ths);
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        __unds_heap_queue_reheap_up(ths, ths->size);
+        ths->size++;
+    }
+}
+
+void unds_heap_queue_heapify(unds_heap_queue_t* ths)
+{
+    unds_heapify(ths->arr, ths->size, ths->of_size, ths->comp);
+}
+
+void unds_heap_queue_merge(unds_heap_queue_t* ths, unds_heap_queue_t* other)
+{
+    if (ths->of_size != other->of_size)
+    {
+        fprintf(stderr, "stderr: Failed to merge heap queues because their element sizes differ.\n");
+        abort();
+    }
+
+    if (ths == other || other->size == 0)
+        return;
+
+    unds_heap_queue_reserve(ths, ths->size + other->size);
+
+    memcpy((char*)ths->arr + ths->size * ths->of_size, other->arr, other->size * ths->of_size);
+    ths->size += other->size;
+
+    unds_heap_queue_heapify(ths);
+    unds_heap_queue_clear(other);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 상위 k개 수집기의 힙에서 요소를 위로 올림
+ * @param ths 대상 수집기 포인터
+ * @param index 올릴 요소의 인덱스
+ */
+void __unds_top_k_sift_up(unds_top_k_t* ths, size_t index)
+{
+    char* base = (char*)ths->arr;
+    size_t of_size = ths->of_size;
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (ths->comp(base + parent * of_size, base + index * of_size) >= 0)
+            break;
+
+        __unds_sort_swap(base + parent * of_size, base + index * of_size, of_size);
+        index = parent;
+    }
+}
+
+unds_top_k_t* unds_top_k_create(size_t of_size, size_t k, int (*comp)(const void* p, const void* q))
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of top-k collector cannot be zero.\n");
+        abort();
+    }
+
+    unds_top_k_t* ths = (unds_top_k_t*)unds_malloc(sizeof(unds_top_k_t));
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for top-k collector in unds_top_k_create().\n");
+        abort();
+    }
+
+    ths->arr = unds_malloc((k > 0 ? k : 1) * of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for top-k collector in unds_top_k_create().\n");
+        abort();
+    }
+
+    ths->k = k;
+    ths->size = 0;
+    ths->of_size = of_size;
+    ths->comp = comp;
+
+    return ths;
+}
+
+void unds_top_k_delete(unds_top_k_t* ths)
+{
+    unds_free(ths->arr);
+    unds_free(ths);
+}
+
+bool unds_top_k_empty(unds_top_k_t* ths)
+{
+    return ths->size == 0;
+}
+
+size_t unds_top_k_size(unds_top_k_t* ths)
+{
+    return ths->size;
+}
+
+bool unds_top_k_push(unds_top_k_t* ths, void* value)
+{
+    if (ths->size < ths->k)
+    {
+        memcpy((char*)ths->arr + ths->size * ths->of_size, value, ths->of_size);
+        __unds_top_k_sift_up(ths, ths->size);
+        ths->size++;
+        return true;
+    }
+
+    // 가장 뒤처진 요소보다 앞서지 않으면 한 번의 비교로 버린다.
+    if (ths->k == 0 || ths->comp(value, ths->arr) >= 0)
+        return false;
+
+    struct __unds_sort_context_t ctx;
+
+    ctx.of_size = ths->of_size;
+    ctx.comp = ths->comp;
+    ctx.temp = NULL;
+
+    memcpy(ths->arr, value, ths->of_size);
+    __unds_sort_sift_down(&ctx, (char*)ths->arr, 0, ths->size);
+
+    return true;
+}
+
+void unds_top_k_push_n(unds_top_k_t* ths, void* arr, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        unds_top_k_push(ths, (char*)arr + i * ths->of_size);
+}
+
+void unds_top_k_threshold(unds_top_k_t* ths, void* dest)
+{
+    if (ths->size == 0)
+    {
+        fprintf(stderr, "stderr: Failed to read the threshold of top-k collector because it is empty.\n");
+        abort();
+    }
+
+    memcpy(dest, ths->arr, ths->of_size);
+}
+
+void unds_top_k_sorted(unds_top_k_t* ths, void* dest)
+{
+    memcpy(dest, ths->arr, ths->size * ths->of_size);
+    unds_sort(dest, ths->size, ths->of_size, ths->comp);
+}
+
+void unds_top_k_clear(unds_top_k_t* ths)
+{
+    ths->size = 0;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 크기를 페어링 힙의 정렬 단위로 올림
+ * @param size 올릴 크기
+ * @return 정렬 단위의 배수로 올린 크기
+ */
+size_t __unds_pairing_heap_round(size_t size)
+{
+    return (size + __UNDS_PAIRING_HEAP_ALIGN - 1) / __UNDS_PAIRING_HEAP_ALIGN * __UNDS_PAIRING_HEAP_ALIGN;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 노드에 저장된 값의 주소 반환
+ * @param node 대상 노드
+ * @return 값의 주소
+ */
+void* __unds_pairing_heap_value(unds_pairing_heap_node_t* node)
+{
+    return (char*)node + __unds_pairing_heap_round(sizeof(unds_pairing_heap_node_t));
+}
+
+/**
+ * *내부 함수
+ *
+ * 블록의 노드는 모두 빈 노드 목록의 앞에 연결한다.
+ *
+ * @brief 페어링 힙에 새로운 노드 블록 할당
+ * @param ths 대상 페어링 힙 포인터
+ */
+void __unds_pairing_heap_grow(unds_pairing_heap_t* ths)
+{
+    size_t count = ths->capacity > __UNDS_PAIRING_HEAP_MIN_BLOCK ? ths->capacity : __UNDS_PAIRING_HEAP_MIN_BLOCK;
+    size_t header = __unds_pairing_heap_round(sizeof(struct __unds_pairing_heap_block_t));
+
+    struct __unds_pairing_heap_block_t* block = (struct __unds_pairing_heap_block_t*)unds_malloc(header + count * ths->node_size);
+    if (block == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for pairing heap in __unds_pairing_heap_grow().\n");
+        abort();
+    }
+
+    block->next = ths->blocks;
+    if (ths->blocks == NULL)
+        ths->blocks_tail = block;
+    ths->blocks = block;
+    ths->capacity += count;
+
+    char* first = (char*)block + header;
+    for (size_t i = 0; i < count; i++)
+    {
+        unds_pairing_heap_node_t* node = (unds_pairing_heap_node_t*)(first + i * ths->node_size);
+        node->next = i + 1 < count ? (unds_pairing_heap_node_t*)(first + (i + 1) * ths->node_size) : ths->free_head;
+    }
+
+    if (ths->free_head == NULL)
+        ths->free_tail = (unds_pairing_heap_node_t*)(first + (count - 1) * ths->node_size);
+    ths->free_head = (unds_pairing_heap_node_t*)first;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 두 부분 힙을 병합
+ * @param ths 대상 페어링 힙 포인터
+ * @param a 병합할 부분 힙의 뿌리 (형제가 없어야 한다.)
+ * @param b 병합할 부분 힙의 뿌리 (형제가 없어야 한다.)
+ * @return 병합된 부분 힙의 뿌리
+ */
+unds_pairing_heap_node_t* __unds_pairing_heap_link(unds_pairing_heap_t* ths, unds_pairing_heap_node_t* a, unds_pairing_heap_node_t* b)
+{
+    if (a == NULL)
+        return b;
+    if (b == NULL)
+        return a;
+
+    if (ths->comp(__unds_pairing_heap_value(b), __unds_pairing_heap_value(a)) < 0)
+    {
+        unds_pairing_heap_node_t* temp = a;
+        a = b;
+        b = temp;
+    }
+
+    b->prev = a;
+    b->next = a->child;
+    if (a->child != NULL)
+        a->child->prev = b;
+    a->child = b;
+
+    return a;
+}
+
+/**
+ * *내부 함수
+ *
+ * 왼쪽부터 둘씩 병합한 뒤 오른쪽부터 차례로 병합한다. (two-pass)
+ *
+ * @brief 형제 목록을 하나의 부분 힙으로 병합
+ * @param ths 대상 페어링 힙 포인터
+ * @param first 형제 목록의 첫 노드
+ * @return 병합된 부분 힙의 뿌리
+ */
+unds_pairing_heap_node_t* __unds_pairing_heap_combine(unds_pairing_heap_t* ths, unds_pairing_heap_node_t* first)
+{
+    unds_pairing_heap_node_t* pairs = NULL;
+
+    // 병합한 쌍은 next로 역순으로 연결해 두었다가 두 번째 단계에서 앞에서부터 꺼낸다.
+    while (first != NULL)
+    {
+        unds_pairing_heap_node_t* a = first;
+        unds_pairing_heap_node_t* b = a->next;
+
+        a->next = a->prev = NULL;
+        if (b == NULL)
+        {
+            a->next = pairs;
+            pairs = a;
+            break;
+        }
+
+        first = b->next;
+        b->next = b->prev = NULL;
+
+        unds_pairing_heap_node_t* merged = __unds_pairing_heap_link(ths, a, b);
+        merged->next = pairs;
+        pairs = merged;
+    }
+
+    unds_pairing_heap_node_t* result = NULL;
+    while (pairs != NULL)
+    {
+        unds_pairing_heap_node_t* node = pairs;
+        pairs = pairs->next;
+        node->next = NULL;
+        result = __unds_pairing_heap_link(ths, result, node);
+    }
+
+    return result;
+}
+
+unds_pairing_heap_t* unds_pairing_heap_create(size_t of_size, int (*comp)(const void* p, const void* q))
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of pairing heap cannot be zero.\n");
+        abort();
+    }
+
+    unds_pairing_heap_t* ths = (unds_pairing_heap_t*)unds_malloc(sizeof(unds_pairing_heap_t));
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for pairing heap in unds_pairing_heap_create().\n");
+        abort();
+    }
+
+    ths->root = NULL;
+    ths->blocks = NULL;
+    ths->blocks_tail = NULL;
+    ths->free_head = NULL;
+    ths->free_tail = NULL;
+    ths->size = 0;
+    ths->capacity = 0;
+    ths->of_size = of_size;
+    ths->node_size = __unds_pairing_heap_round(sizeof(unds_pairing_heap_node_t)) + __unds_pairing_heap_round(of_size);
+    ths->comp = comp;
+
+    return ths;
+}
+
+void unds_pairing_heap_delete(unds_pairing_heap_t* ths)
+{
+    unds_pairing_heap_clear(ths);
+    unds_free(ths);
+}
+
+bool unds_pairing_heap_empty(unds_pairing_heap_t* ths)
+{
+    return ths->size == 0;
+}
+
+size_t unds_pairing_heap_size(unds_pairing_heap_t* ths)
+{
+    return ths->size;
+}
+
+unds_pairing_heap_node_t* unds_pairing_heap_push(unds_pairing_heap_t* ths, void* value)
+{
+    if (ths->free_head == NULL)
+        __unds_pairing_heap_grow(ths);
+
+    unds_pairing_heap_node_t* node = ths->free_head;
+    ths->free_head = node->next;
+    if (ths->free_head == NULL)
+        ths->free_tail = NULL;
+
+    node->child = node->next = node->prev = NULL;
+    memcpy(__unds_pairing_heap_value(node), value, ths->of_size);
+
+    ths->root = __unds_pairing_heap_link(ths, ths->root, node);
+    ths->size++;
+
+    return node;
+}
+
+void unds_pairing_heap_pop(unds_pairing_heap_t* ths)
+{
+    if (unds_pairing_heap_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop an element from pairing heap because the pairing heap is empty.\n");
+        abort();
+    }
+
+    unds_pairing_heap_node_t* root = ths->root;
+    ths->root = __unds_pairing_heap_combine(ths, root->child);
+    ths->size--;
+
+    root->next = ths->free_head;
+    if (ths->free_head == NULL)
+        ths->free_tail = root;
+    ths->free_head = root;
+}
+
+void unds_pairing_heap_front(unds_pairing_heap_t* ths, void* dest)
+{
+    if (unds_pairing_heap_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to read from the front of the pairing heap because the pairing heap is empty.\n");
+        abort();
+    }
+
+    memcpy(dest, __unds_pairing_heap_value(ths->root), ths->of_size);
+}
+
+void unds_pairing_heap_get(unds_pairing_heap_t* ths, unds_pairing_heap_node_t* node, void* dest)
+{
+    memcpy(dest, __unds_pairing_heap_value(node), ths->of_size);
+}
+
+void unds_pairing_heap_decrease(unds_pairing_heap_t* ths, unds_pairing_heap_node_t* node, void* value)
+{
+    if (ths->comp(value, __unds_pairing_heap_value(node)) > 0)
+    {
+        fprintf(stderr, "stderr: Failed to decrease a key of pairing heap because the new value comes after the old one.\n");
+        abort();
+    }
+
+    memcpy(__unds_pairing_heap_value(node), value, ths->of_size);
+    if (node == ths->root)
+        return;
+
+    // 부모에서 잘라낸 부분 힙을 뿌리와 다시 병합한다.
+    if (node->prev->child == node)
+        node->prev->child = node->next;
+    else
+        node->prev->next = node->next;
+    if (node->next != NULL)
+        node->next->prev = node->prev;
+    node->next = node->prev = NULL;
+
+    ths->root = __unds_pairing_heap_link(ths, ths->root, node);
+}
+
+void unds_pairing_heap_meld(unds_pairing_heap_t* ths, unds_pairing_heap_t* other)
+{
+    if (ths->of_size != other->of_size)
+    {
+        fprintf(stderr, "stderr: Failed to meld pairing heaps because their element sizes differ.\n");
+        abort();
+    }
+
+    if (ths == other)
+        return;
+
+    ths->root = __unds_pairing_heap_link(ths, ths->root, other->root);
+    ths->size += other->size;
+    ths->capacity += other->capacity;
+
+    // 블록과 빈 노드는 목록의 끝을 알고 있으므로 통째로 앞에 잇는다.
+    if (other->blocks != NULL)
+    {
+        other->blocks_tail->next = ths->blocks;
+        if (ths->blocks == NULL)
+            ths->blocks_tail = other->blocks_tail;
+        ths->blocks = other->blocks;
+    }
+
+    if (other->free_head != NULL)
+    {
+        other->free_tail->next = ths->free_head;
+        if (ths->free_head == NULL)
+            ths->free_tail = other->free_tail;
+        ths->free_head = other->free_head;
+    }
+
+    other->root = NULL;
+    other->blocks = NULL;
+    other->blocks_tail = NULL;
+    other->free_head = NULL;
+    other->free_tail = NULL;
+    other->size = 0;
+    other->capacity = 0;
+}
+
+void unds_pairing_heap_clear(unds_pairing_heap_t* ths)
+{
+    while (ths->blocks != NULL)
+    {
+        struct __unds_pairing_heap_block_t* next = ths->blocks->next;
+        unds_free(ths->blocks);
+        ths->blocks = next;
+    }
+
+    ths->root = NULL;
+    ths->blocks_tail = NULL;
+    ths->free_head = NULL;
+    ths->free_tail = NULL;
+    ths->size = 0;
+    ths->capacity = 0;
+}
 
 /**
- * @brief 새로운 스택 생성
- * @param of_size 스택에 저장할 단일 요소의 크기
- * @return 동적으로 생성된 스택의 주소
+ * *내부 함수
+ *
+ * @brief 인덱스의 요소가 최소 단계(짝수 깊이)에 있는지 여부 반환
+ * @param index 요소의 인덱스
+ * @return 최소 단계 여부
  */
-unds_stack_t* unds_stack_create(size_t of_size);
+bool __unds_min_max_heap_is_min_level(size_t index)
+{
+    size_t level = 0;
 
-/**
- * @brief 배열로부터 새로운 스택 생성
- * @param arr 스택으로 생성할 배열의 포인터
- * @param size 스택으로 생성할 배열의 길이
- * @param of_size 스택으로 생성할 배열의 단일 요소의 크기
- * @return 동적으로 생성된 스택의 주소
- */
-unds_stack_t* unds_stack_create_from_array(void* arr, size_t size, size_t of_size);
+    for (index++; index > 1; index >>= 1)
+        level++;
+
+    return level % 2 == 0;
+}
 
 /**
- * @brief 기본값을 설정하여 새로운 스택 생성
- * @param value 스택의 기본값으로 설정할 값의 포인터
- * @param size 생성할 스택의 길이
- * @param of_size 스택의 기본값으로 설정할 값의 크기
- * @return 동적으로 생성된 스택의 주소
+ * *내부 함수
+ *
+ * @brief 인덱스의 요소에 대한 포인터 반환
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param index 요소의 인덱스
+ * @return 요소의 포인터
  */
-unds_stack_t* unds_stack_create_from_value(void* value, size_t size, size_t of_size);
+char* __unds_min_max_heap_at(unds_min_max_heap_t* ths, size_t index)
+{
+    return (char*)ths->arr + index * ths->of_size;
+}
 
 /**
- * @brief 스택 삭제
- * @param ths 대상 스택 포인터
+ * *내부 함수
+ *
+ * 최대 단계에서는 비교 방향을 뒤집는다.
+ *
+ * @brief 해당 단계에서 i의 요소가 j의 요소보다 위에 있어야 하는지 여부 반환
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param i 비교할 요소의 인덱스
+ * @param j 비교할 요소의 인덱스
+ * @param max_level 최대 단계인지 여부
+ * @return i의 요소가 위에 있어야 하는지 여부
  */
-void unds_stack_delete(unds_stack_t* ths);
+bool __unds_min_max_heap_before(unds_min_max_heap_t* ths, size_t i, size_t j, bool max_level)
+{
+    if (max_level)
+        return ths->comp(__unds_min_max_heap_at(ths, j), __unds_min_max_heap_at(ths, i)) < 0;
+    return ths->comp(__unds_min_max_heap_at(ths, i), __unds_min_max_heap_at(ths, j)) < 0;
+}
 
 /**
- * @brief 스택이 비었는지 여부 반환
- * @param ths 대상 스택 포인터
- * @return 스택 빔 여부
+ * *내부 함수
+ *
+ * @brief 같은 종류의 단계를 따라 조부모 방향으로 요소를 올림
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param index 올릴 요소의 인덱스
+ * @param max_level 요소가 최대 단계에 있는지 여부
  */
-bool unds_stack_empty(unds_stack_t* ths);
+void __unds_min_max_heap_bubble_up_level(unds_min_max_heap_t* ths, size_t index, bool max_level)
+{
+    while (index > 2)
+    {
+        size_t grandparent = ((index - 1) / 2 - 1) / 2;
+        if (!__unds_min_max_heap_before(ths, index, grandparent, max_level))
+            break;
+
+        __unds_sort_swap(__unds_min_max_heap_at(ths, index), __unds_min_max_heap_at(ths, grandparent), ths->of_size);
+        index = grandparent;
+    }
+}
 
 /**
- * @brief 스택에 새로운 요소 삽입
- * @param ths 대상 스택 포인터
- * @param value 삽입할 대상을 가리키는 포인터
+ * *내부 함수
+ *
+ * @brief 새로 들어온 요소를 제자리로 올림
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param index 올릴 요소의 인덱스
  */
-void unds_stack_push(unds_stack_t* ths, void* value);
+void __unds_min_max_heap_bubble_up(unds_min_max_heap_t* ths, size_t index)
+{
+    if (index == 0)
+        return;
+
+    bool max_level = !__unds_min_max_heap_is_min_level(index);
+    size_t parent = (index - 1) / 2;
+
+    // 부모의 단계 기준으로 부모보다 위에 있어야 하면 부모와 바꾼 뒤 부모 쪽 단계를 따라 올린다.
+    if (__unds_min_max_heap_before(ths, index, parent, !max_level))
+    {
+        __unds_sort_swap(__unds_min_max_heap_at(ths, index), __unds_min_max_heap_at(ths, parent), ths->of_size);
+        __unds_min_max_heap_bubble_up_level(ths, parent, !max_level);
+    }
+    else
+        __unds_min_max_heap_bubble_up_level(ths, index, max_level);
+}
 
 /**
- * @brief 스택의 마지막 요소를 삭제
- * @param ths 대상 스택 포인터
+ * *내부 함수
+ *
+ * @brief 요소를 자식과 손자 중 가장 알맞은 자리로 내림
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param index 내릴 요소의 인덱스
  */
-void unds_stack_pop(unds_stack_t* ths);
+void __unds_min_max_heap_push_down(unds_min_max_heap_t* ths, size_t index)
+{
+    bool max_level = !__unds_min_max_heap_is_min_level(index);
+
+    while (true)
+    {
+        size_t first_child = 2 * index + 1;
+        if (first_child >= ths->size)
+            return;
+
+        // 자식과 손자 중 이 단계 기준으로 가장 위에 있어야 할 요소를 찾는다.
+        size_t best = first_child;
+        if (first_child + 1 < ths->size && __unds_min_max_heap_before(ths, first_child + 1, best, max_level))
+            best = first_child + 1;
+
+        size_t first_grandchild = 2 * first_child + 1;
+        for (size_t i = first_grandchild; i < first_grandchild + 4 && i < ths->size; i++)
+            if (__unds_min_max_heap_before(ths, i, best, max_level))
+                best = i;
+
+        if (!__unds_min_max_heap_before(ths, best, index, max_level))
+            return;
+
+        __unds_sort_swap(__unds_min_max_heap_at(ths, best), __unds_min_max_heap_at(ths, index), ths->of_size);
+        if (best < first_grandchild)
+            return;
+
+        // 손자와 바꾼 경우 그 부모(반대 단계)와의 순서도 맞춘다.
+        size_t parent = (best - 1) / 2;
+        if (__unds_min_max_heap_before(ths, parent, best, max_level))
+            __unds_sort_swap(__unds_min_max_heap_at(ths, best), __unds_min_max_heap_at(ths, parent), ths->of_size);
+
+        index = best;
+    }
+}
 
 /**
- * @brief 스택의 마지막 요소를 dest에 복사
- * @param ths 대상 스택 포인터
- * @param dest 요소를 복사할 목적지
+ * *내부 함수
+ *
+ * @brief 가장 뒤처진 요소의 인덱스 반환
+ * @param ths 대상 최소-최대 힙 포인터 (비어 있지 않아야 한다.)
+ * @return 가장 뒤처진 요소의 인덱스
  */
-void unds_stack_top(unds_stack_t* ths, void* dest);
+size_t __unds_min_max_heap_max_index(unds_min_max_heap_t* ths)
+{
+    if (ths->size == 1)
+        return 0;
+    if (ths->size == 2)
+        return 1;
+
+    return ths->comp(__unds_min_max_heap_at(ths, 1), __unds_min_max_heap_at(ths, 2)) >= 0 ? 1 : 2;
+}
 
 /**
- * @brief 스택 초기화
- * @param ths 대상 스택 포인터
+ * *내부 함수
+ *
+ * @brief 인덱스의 요소를 삭제하고 마지막 요소로 채움
+ * @param ths 대상 최소-최대 힙 포인터
+ * @param index 삭제할 요소의 인덱스
  */
-void unds_stack_clear(unds_stack_t* ths);
+void __unds_min_max_heap_remove(unds_min_max_heap_t* ths, size_t index)
+{
+    ths->size--;
+    if (index == ths->size)
+        return;
 
-#ifdef UNDS_IMPLEMENTATION
+    memcpy(__unds_min_max_heap_at(ths, index), __unds_min_max_heap_at(ths, ths->size), ths->of_size);
+    __unds_min_max_heap_push_down(ths, index);
+}
 
-unds_pair_t* unds_pair_create(size_t of_size_first, size_t of_size_second)
+unds_min_max_heap_t* unds_min_max_heap_create(size_t of_size, int (*comp)(const void* p, const void* q))
 {
-    if (of_size_first == 0 || of_size_second == 0)
+    return unds_min_max_heap_create_from_array(NULL, 0, of_size, comp);
+}
+
+unds_min_max_heap_t* unds_min_max_heap_create_from_array(void* arr, size_t size, size_t of_size, int (*comp)(const void* p, const void* q))
+{
+    if (arr == NULL && size > 0)
     {
-        fprintf(stderr, "stderr: Size of a single element of pair cannot be zero.\n");
+        fprintf(stderr, "stderr: Failed to initialize min-max heap since the original array is NULL.\n");
+        abort();
+    }
+    else if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of min-max heap cannot be zero.\n");
         abort();
     }
 
-    unds_pair_t* ths = (unds_pair_t*)unds_malloc(sizeof(unds_pair_t));
+    unds_min_max_heap_t* ths = (unds_min_max_heap_t*)unds_malloc(sizeof(unds_min_max_heap_t));
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for min-max heap in unds_min_max_heap_create_from_array().\n");
+        abort();
+    }
 
-    ths->first = unds_malloc(of_size_first);
-    ths->second = unds_malloc(of_size_second);
-    if (ths->first == NULL || ths->second == NULL)
+    size_t capacity = 1;
+    while (capacity < size)
+        capacity *= 2;
+
+    ths->arr = __unds_storage_alloc(capacity * of_size);
+    if (ths->arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for pair in pair_create().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for min-max heap in unds_min_max_heap_create_from_array().\n");
         abort();
     }
 
-    ths->of_size_first = of_size_first;
-    ths->of_size_second = of_size_second;
+    ths->capacity = capacity;
+    ths->size = size;
+    ths->of_size = of_size;
+    ths->comp = comp;
+
+    if (size > 0)
+        memcpy(ths->arr, arr, size * of_size);
+    for (size_t i = size / 2; i-- > 0;)
+        __unds_min_max_heap_push_down(ths, i);
 
     return ths;
 }
 
-unds_pair_t* unds_pair_make(void* first, size_t of_size_first, void* second, size_t of_size_second)
+void unds_min_max_heap_delete(unds_min_max_heap_t* ths)
 {
-    if (first == NULL || second == NULL)
+    __unds_storage_free(ths->arr);
+    unds_free(ths);
+}
+
+bool unds_min_max_heap_empty(unds_min_max_heap_t* ths)
+{
+    return ths->size == 0;
+}
+
+size_t unds_min_max_heap_size(unds_min_max_heap_t* ths)
+{
+    return ths->size;
+}
+
+void unds_min_max_heap_push(unds_min_max_heap_t* ths, void* value)
+{
+    if (ths->size == ths->capacity)
+        unds_min_max_heap_reserve(ths, ths->capacity * 2);
+
+    memcpy(__unds_min_max_heap_at(ths, ths->size), value, ths->of_size);
+    __unds_min_max_heap_bubble_up(ths, ths->size);
+
+    ths->size++;
+}
+
+void unds_min_max_heap_front_min(unds_min_max_heap_t* ths, void* dest)
+{
+    if (unds_min_max_heap_empty(ths))
     {
-        fprintf(stderr, "stderr: Pair element cannot be NULL.\n");
+        fprintf(stderr, "stderr: Failed to read the minimum of the min-max heap because the min-max heap is empty.\n");
         abort();
     }
 
-    unds_pair_t* ths = unds_pair_create(of_size_first, of_size_second);
+    memcpy(dest, ths->arr, ths->of_size);
+}
 
-    memcpy(ths->first, first, ths->of_size_first);
-    memcpy(ths->second, second, ths->of_size_second);
+void unds_min_max_heap_front_max(unds_min_max_heap_t* ths, void* dest)
+{
+    if (unds_min_max_heap_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to read the maximum of the min-max heap because the min-max heap is empty.\n");
+        abort();
+    }
 
-    return ths;
+    memcpy(dest, __unds_min_max_heap_at(ths, __unds_min_max_heap_max_index(ths)), ths->of_size);
 }
 
-void unds_pair_delete(unds_pair_t* ths)
+void unds_min_max_heap_pop_min(unds_min_max_heap_t* ths)
 {
-    unds_free(ths->first);
-    unds_free(ths->second);
-    unds_free(ths);
+    if (unds_min_max_heap_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop the minimum from min-max heap because the min-max heap is empty.\n");
+        abort();
+    }
+
+    __unds_min_max_heap_remove(ths, 0);
 }
 
-void unds_pair_get_first(unds_pair_t* ths, void* dest)
+void unds_min_max_heap_pop_max(unds_min_max_heap_t* ths)
 {
-    memcpy(dest, ths->first, ths->of_size_first);
+    if (unds_min_max_heap_empty(ths))
+    {
+        fprintf(stderr, "stderr: Failed to pop the maximum from min-max heap because the min-max heap is empty.\n");
+        abort();
+    }
+
+    __unds_min_max_heap_remove(ths, __unds_min_max_heap_max_index(ths));
 }
 
-void unds_pair_get_second(unds_pair_t* ths, void* dest)
+void unds_min_max_heap_clear(unds_min_max_heap_t* ths)
 {
-    memcpy(dest, ths->second, ths->of_size_second);
+    ths->size = 0;
 }
 
-void unds_pair_set_first(unds_pair_t* ths, void* value)
+void unds_min_max_heap_reserve(unds_min_max_heap_t* ths, size_t capacity)
 {
-    memcpy(ths->first, value, ths->of_size_first);
+    if (capacity <= ths->capacity)
+        return;
+
+    size_t correct_capacity = __unds_grow_capacity(ths->capacity, capacity, ths->of_size, "unds_min_max_heap_reserve");
+
+    ths->arr = __unds_storage_realloc(ths->arr, correct_capacity * ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for min-max heap in unds_min_max_heap_reserve().\n");
+        abort();
+    }
+
+    ths->capacity = correct_capacity;
 }
 
-void unds_pair_set_second(unds_pair_t* ths, void* value)
+void unds_min_max_heap_shrink_to_fit(unds_min_max_heap_t* ths)
 {
-    memcpy(ths->second, value, ths->of_size_second);
+    size_t correct_capacity = 1;
+
+    while (correct_capacity < ths->size)
+        correct_capacity *= 2;
+
+    if (correct_capacity == ths->capacity)
+        return;
+
+    ths->arr = __unds_storage_realloc(ths->arr, correct_capacity * ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for min-max heap in unds_min_max_heap_shrink_to_fit().\n");
+        abort();
+    }
+
+    ths->capacity = correct_capacity;
 }
 
 /**
  * *내부 함수
- *
- * @brief 리스트 크기 2배 증가
- * @param ths 대상 리스트 포인터
+ * 
+ * @brief 큐 크기 2배 증가
+ * @param ths 대상 큐 포인터
  */
-void __unds_list_double(unds_list_t* ths)
+void __unds_queue_double(unds_queue_t* ths)
 {
+    size_t old_capacity = ths->capacity;
+    size_t head = ths->head & (old_capacity - 1);
+
     ths->capacity *= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, old_capacity, ths->capacity, ths->of_size);
     if (ths->arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for list in __list_double().\n");
+        fprintf(stderr, "stderr: Failed to reallocate memory for queue in __queue_double().\n");
         abort();
     }
+
+    // 앞으로 돌아간 부분을 기존 공간의 바로 뒤로 옮겨 요소가 연속되도록 한다.
+    if (head + ths->size > old_capacity)
+        memcpy((char*)ths->arr + old_capacity * ths->of_size, ths->arr, (head + ths->size - old_capacity) * ths->of_size);
+
+    ths->head = head;
+    ths->tail = head + ths->size;
 }
 
 /**
  * *내부 함수
  *
- * @brief 리스트 크기 2배 감소
- * @param ths 대상 리스트 포인터
+ * @brief 큐의 크기를 2의 제곱수로 교정
+ * @param ths 대상 큐 포인터
  */
-void __unds_list_half(unds_list_t* ths)
+void __unds_queue_capacity_correction(unds_queue_t* ths)
 {
-    if (ths->size == 0)
-        return;
+    size_t correct_capacity = 1;
 
-    ths->capacity /= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
+    while (correct_capacity < ths->size)
+        correct_capacity *= 2;
+    if (correct_capacity < ths->inline_capacity)
+        correct_capacity = ths->inline_capacity;
+
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity, correct_capacity, ths->of_size);
     if (ths->arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for list in __list_half().\n");
+        fprintf(stderr, "stderr: Failed to reallocate memory for queue in __queue_capacity_correction().\n");
         abort();
     }
+
+    ths->capacity = correct_capacity;
 }
 
 /**
  * *내부 함수
  *
- * @brief 리스트의 크기를 2의 제곱수로 교정
- * @param ths 대상 리스트 포인터
+ * @brief 큐를 새로운 공간으로 옮기며 용량 변경
+ * @param ths 대상 큐 포인터
+ * @param capacity 변경할 용량
  */
-void __unds_list_capacity_correction(unds_list_t* ths)
+void __unds_queue_resize(unds_queue_t* ths, size_t capacity)
 {
-    size_t correct_capacity = 1;
-
-    while (correct_capacity <= ths->size)
-        correct_capacity *= 2;
+    if (capacity < ths->inline_capacity)
+        capacity = ths->inline_capacity;
+    if (capacity == ths->capacity)
+        return;
 
-    ths->arr = unds_realloc(ths->arr, correct_capacity * ths->of_size);
-    if (ths->arr == NULL)
+    // 내장 공간을 사용 중이면 용량이 inline_capacity와 같으므로, 용량이 바뀌면 내장 공간과 힙 사이를 옮기게 된다.
+    void* arr = capacity <= ths->inline_capacity ? ths->inline_arr : __unds_storage_alloc(capacity * ths->of_size);
+    if (arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for stack in __list_capacity_correction().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in __unds_queue_resize().\n");
         abort();
     }
 
-    ths->capacity = correct_capacity;
+    __unds_ring_copy_out(ths->arr, ths->capacity, ths->of_size, ths->head & (ths->capacity - 1), arr, ths->size);
+    if (ths->arr != ths->inline_arr)
+        __unds_storage_free(ths->arr);
+
+    ths->arr = arr;
+    ths->capacity = capacity;
+    ths->head = 0;
+    ths->tail = ths->size;
+}
+
+/**
+ * *내부 함수
+ * 
+ * @brief 큐 크기 2배 감소
+ * @param ths 대상 큐 포인터
+ */
+void __unds_queue_half(unds_queue_t* ths)
+{
+    __unds_queue_resize(ths, ths->capacity / 2);
 }
 
-unds_list_t* unds_list_create(size_t of_size)
+unds_queue_t* unds_queue_create(size_t of_size)
 {
-    unds_list_t* ths = (unds_list_t*)unds_malloc(sizeof(unds_list_t));
+    unds_queue_t* ths = (unds_queue_t*)unds_malloc(sizeof(unds_queue_t));
 
-    ths->arr = unds_malloc(of_size);
+    ths->arr = __unds_storage_alloc(of_size);
     if (ths->arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for list in list_create().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in queue_create().\n");
         abort();
     }
 
     ths->capacity = 1;
     ths->size = 0;
     ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
+    ths->head = 0;
+    ths->tail = 0;
 
     return ths;
 }
 
-unds_list_t* unds_list_create_from_array(void* arr, size_t size, size_t of_size)
+unds_queue_t* unds_queue_create_from_array(void* arr, size_t size, size_t of_size)
 {
     if (arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to initialize list since the original array is NULL.\n");
+        fprintf(stderr, "stderr: Failed to initialize queue since the original array is NULL.\n");
         abort();
     }
     else if (of_size == 0)
     {
-        fprintf(stderr, "stderr: Size of a single element of list cannot be zero.");
+        fprintf(stderr, "stderr: Size of a single element of queue cannot be zero.");
         abort();
     }
 
-    unds_list_t* ths = (unds_list_t*)unds_malloc(sizeof(unds_list_t));
+    unds_queue_t* ths = (unds_queue_t*)unds_malloc(sizeof(unds_queue_t));
 
-    ths->arr = unds_malloc(size * of_size);
+    ths->arr = __unds_storage_alloc(size * of_size);
     if (ths->arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for list in list_create_from_array().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in queue_create_from_array().\n");
         abort();
     }
 
     ths->capacity = size;
     ths->size = size;
     ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
+    ths->head = 0;
+    ths->tail = size;
 
     memcpy(ths->arr, arr, size * of_size);
-    __unds_list_capacity_correction(ths);
+    __unds_queue_capacity_correction(ths);
 
     return ths;
 }
 
-unds_list_t* unds_list_create_from_value(void* value, size_t size, size_t of_size)
+unds_queue_t* unds_queue_create_from_value(void* value, size_t size, size_t of_size)
 {
     if (value == NULL)
     {
-        fprintf(stderr, "stderr: Failed to initialize list since the original array is NULL.\n");
+        fprintf(stderr, "stderr: Failed to initialize queue since the original array is NULL.\n");
         abort();
     }
     else if (of_size == 0)
     {
-        fprintf(stderr, "stderr: Size of a single element of list cannot be zero.");
+        fprintf(stderr, "stderr: Size of a single element of queue cannot be zero.");
         abort();
     }
 
-    unds_list_t* ths = (unds_list_t*)unds_malloc(sizeof(unds_list_t));
-    ths->arr = unds_malloc(size * of_size);
+    unds_queue_t* ths = (unds_queue_t*)unds_malloc(sizeof(unds_queue_t));
+    ths->arr = __unds_storage_alloc(size * of_size);
     if (ths->arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for list in list_create_from_array().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in queue_create_from_array().\n");
         abort();
     }
 
     ths->capacity = size;
     ths->size = size;
     ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
+    ths->head = 0;
+    ths->tail = size;
 
     for (size_t i = 0; i < size; i++)
         memcpy((char*)ths->arr + i * of_size, value, of_size);
-    __unds_list_capacity_correction(ths);
+    __unds_queue_capacity_correction(ths);
     
     return ths;
 }
 
-void unds_list_delete(unds_list_t* ths)
+unds_queue_t* unds_queue_create_inline(size_t of_size, size_t capacity)
 {
-    unds_free(ths->arr);
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of queue cannot be zero.\n");
+        abort();
+    }
+
+    capacity = __unds_inline_capacity(capacity);
+
+    unds_queue_t* ths = (unds_queue_t*)unds_malloc(__UNDS_INLINE_OFFSET(unds_queue_t) + capacity * of_size);
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in unds_queue_create_inline().\n");
+        abort();
+    }
+
+    unds_queue_init(ths, of_size, capacity > 0 ? (char*)ths + __UNDS_INLINE_OFFSET(unds_queue_t) : NULL, capacity);
+
+    return ths;
+}
+
+void unds_queue_init(unds_queue_t* ths, size_t of_size, void* storage, size_t capacity)
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of queue cannot be zero.\n");
+        abort();
+    }
+
+    capacity = storage != NULL ? __unds_inline_capacity(capacity) : 0;
+
+    if (capacity == 0)
+    {
+        ths->arr = __unds_storage_alloc(of_size);
+        if (ths->arr == NULL)
+        {
+            fprintf(stderr, "stderr: Failed to allocate memory for queue in unds_queue_init().\n");
+            abort();
+        }
+
+        ths->capacity = 1;
+        ths->inline_arr = NULL;
+    }
+    else
+    {
+        ths->arr = storage;
+        ths->capacity = capacity;
+        ths->inline_arr = storage;
+    }
+
+    ths->inline_capacity = capacity;
+    ths->size = 0;
+    ths->of_size = of_size;
+    ths->head = 0;
+    ths->tail = 0;
+}
+
+void unds_queue_deinit(unds_queue_t* ths)
+{
+    if (ths->arr != ths->inline_arr)
+        __unds_storage_free(ths->arr);
+
+    ths->arr = NULL;
+    ths->capacity = 0;
+    ths->size = 0;
+}
+
+void unds_queue_delete(unds_queue_t* ths)
+{
+    if (ths->arr != ths->inline_arr)
+        __unds_storage_free(ths->arr);
     unds_free(ths);
 }
 
-bool unds_list_empty(unds_list_t* ths)
+bool unds_queue_empty(unds_queue_t* ths)
 {
     return ths->size == 0;
 }
 
-void unds_list_push(unds_list_t* ths, void* value)
+void unds_queue_push(unds_queue_t* ths, void* value)
 {
     if (ths->size == ths->capacity)
-        __unds_list_double(ths);
+        __unds_queue_double(ths);
 
-    memcpy((char*)ths->arr + ths->size++ * ths->of_size, value, ths->of_size);
+    memcpy((char*)ths->arr + (ths->tail & (ths->capacity - 1)) * ths->of_size, value, ths->of_size);
+    ths->tail++;
+
+    ths->size++;
 }
 
-void unds_list_pop(unds_list_t* ths)
+void unds_queue_pop(unds_queue_t* ths)
 {
-    if (unds_list_empty(ths))
+    if (unds_queue_empty(ths))
     {
-        fprintf(stderr, "stderr: Failed to pop an element from list because the list is empty.\n");
+        fprintf(stderr, "stderr: Failed to pop an element from queue because the queue is empty.\n");
         abort();
     }
 
+    ths->head++;
     ths->size--;
 
-    if (ths->size == ths->capacity / 2)
-        __unds_list_half(ths);
+    if (ths->capacity > 1 && ths->size == ths->capacity / 4)
+        __unds_queue_half(ths);
 }
 
-void unds_list_get(unds_list_t* ths, void* dest, size_t index)
+void unds_queue_front(unds_queue_t* ths, void* dest)
 {
-    if (index >= ths->size)
+    if (unds_queue_empty(ths))
     {
-        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        fprintf(stderr, "stderr: Failed to read from the front of the queue because the queue is empty.\n");
         abort();
     }
 
-    memcpy(dest, (char*)ths->arr + index * ths->of_size, ths->of_size);
+    memcpy(dest, (char*)ths->arr + (ths->head & (ths->capacity - 1)) * ths->of_size, ths->of_size);
 }
 
-void unds_list_set(unds_list_t* ths, size_t index, void* value)
+void unds_queue_back(unds_queue_t* ths, void* dest)
 {
-    if (index >= ths->size)
+    if (unds_queue_empty(ths))
     {
-        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        fprintf(stderr, "stderr: Failed to read from the back of the queue because the queue is empty.\n");
         abort();
     }
 
-    memcpy((char*)ths->arr + index * ths->of_size, value, ths->of_size);
+    memcpy(dest, (char*)ths->arr + ((ths->tail - 1) & (ths->capacity - 1)) * ths->of_size, ths->of_size);
 }
 
-void unds_list_insert(unds_list_t* ths, size_t index, void* value)
+void unds_queue_clear(unds_queue_t* ths)
 {
-    if (index >= ths->size + 1)
+    size_t capacity = ths->inline_capacity > 0 ? ths->inline_capacity : 1;
+
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity, capacity, ths->of_size);
+    if (ths->arr == NULL)
     {
-        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
+        fprintf(stderr, "stderr: Failed to reallocate memory for stack in queue_clear().\n");
         abort();
     }
 
-    void* temp = unds_malloc(ths->of_size);
-    unds_list_push(ths, temp);
-    unds_free(temp);
-
-    memmove((char*)ths->arr + (index + 1) * ths->of_size, (char*)ths->arr + index * ths->of_size, (ths->size - index - 1) * ths->of_size);
-    memcpy((char*)ths->arr + index * ths->of_size, value, ths->of_size);
+    ths->capacity = capacity;
+    ths->size = 0;
+    ths->head = 0;
+    ths->tail = 0;
 }
 
-void unds_list_remove(unds_list_t* ths, size_t index)
+void unds_queue_reserve(unds_queue_t* ths, size_t capacity)
 {
-    if (index >= ths->size)
-    {
-        fprintf(stderr, "stderr: List index out of range. Expected less then %zu but found %zu.\n", ths->size, index);
-        abort();
-    }
+    if (capacity <= ths->capacity)
+        return;
 
-    memmove((char*)ths->arr + index * ths->of_size, (char*)ths->arr + (index + 1) * ths->of_size, (ths->size - index) * ths->of_size);
-    unds_list_pop(ths);
+    size_t correct_capacity = __unds_grow_capacity(ths->capacity, capacity, ths->of_size, "unds_queue_reserve");
+
+    __unds_queue_resize(ths, correct_capacity);
 }
 
-void unds_list_clear(unds_list_t* ths)
+void unds_queue_shrink_to_fit(unds_queue_t* ths)
 {
-    ths->arr = unds_realloc(ths->arr, ths->of_size);
-    if (ths->arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to reallocate memory for list in list_clear().\n");
-        abort();
-    }
+    size_t correct_capacity = 1;
 
-    ths->capacity = 1;
-    ths->size = 0;
+    while (correct_capacity < ths->size)
+        correct_capacity *= 2;
+
+    if (correct_capacity < ths->capacity)
+        __unds_queue_resize(ths, correct_capacity);
 }
 
-void unds_list_sort(unds_list_t* ths, int (*comp)(const void*, const void*))
+void unds_queue_push_n(unds_queue_t* ths, void* arr, size_t n)
 {
-    qsort(ths->arr, ths->size, ths->of_size, comp);
+    unds_queue_reserve(ths, ths->size + n);
+
+    __unds_ring_copy_in(ths->arr, ths->capacity, ths->of_size, ths->tail & (ths->capacity - 1), arr, n);
+    ths->tail += n;
+
+    ths->size += n;
 }
 
-/**
- * *내부 함수
- * 
- * @brief 덱 크기 2배 증가
- * @param ths 대상 덱 포인터
- */
-void __unds_deque_double(unds_deque_t* ths)
+void unds_queue_pop_n(unds_queue_t* ths, void* dest, size_t n)
 {
-    ths->capacity *= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
-    if (ths->arr == NULL)
+    if (n > ths->size)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for deque in __unds_deque_double().\n");
+        fprintf(stderr, "stderr: Failed to pop %zu elements from queue because the queue has only %zu.\n", n, ths->size);
         abort();
     }
 
-    if (ths->head > ths->tail)
-    {
-        size_t head_to_end = ths->capacity / 2 - ths->head;
+    if (dest != NULL)
+        __unds_ring_copy_out(ths->arr, ths->capacity, ths->of_size, ths->head & (ths->capacity - 1), dest, n);
 
-        memmove((char*)ths->arr + (ths->capacity - head_to_end) * ths->of_size, (char*)ths->arr + ths->head * ths->of_size, head_to_end * ths->of_size);
+    ths->head += n;
+    ths->size -= n;
 
-        ths->head = ths->capacity - head_to_end;
-    }
+    if (ths->size > 0 && ths->size <= ths->capacity / 4)
+        unds_queue_shrink_to_fit(ths);
 }
 
+#ifdef UNDS_USE_THREADS
+
 /**
  * *내부 함수
- * 
- * @brief 덱 크기 2배 감소
- * @param ths 대상 덱 포인터
+ *
+ * 할당한 원래 주소는 반환한 주소 바로 앞에 저장한다.
+ *
+ * @brief UNDS_CACHE_LINE_SIZE에 정렬된 공간 할당
+ * @param size 할당할 크기
+ * @return 정렬된 공간의 주소 (실패 시 NULL)
  */
-void __unds_deque_half(unds_deque_t* ths)
+void* __unds_cache_aligned_alloc(size_t size)
 {
-    if (ths->size == 0)
-        return;
-
-    if (ths->head < ths->tail)
-        memmove(ths->arr, (char*)ths->arr + ths->head * ths->of_size, ths->size * ths->of_size);
-    else
-    {
-        size_t head_to_end = ths->capacity - ths->head;
-        size_t begin_to_tail = ths->tail;
-
-        memmove((char*)ths->arr + head_to_end * ths->of_size, ths->arr, begin_to_tail * ths->of_size);
-        memmove(ths->arr, (char*)ths->arr + ths->head * ths->of_size, head_to_end * ths->of_size);
-    }
+    char* base = (char*)unds_malloc(size + UNDS_CACHE_LINE_SIZE + sizeof(void*));
+    if (base == NULL)
+        return NULL;
 
-    ths->capacity /= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
-    if (ths->arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to reallocate memory for deque in __unds_deque_half().\n");
-        abort();
-    }
+    uintptr_t addr = (uintptr_t)(base + sizeof(void*));
+    char* ptr = (char*)((addr + UNDS_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(UNDS_CACHE_LINE_SIZE - 1));
+    memcpy(ptr - sizeof(void*), &base, sizeof(void*));
 
-    ths->head = 0;
-    ths->tail = ths->capacity - 1;
+    return ptr;
 }
 
 /**
  * *내부 함수
  *
- * @brief 덱의 크기를 2의 제곱수로 교정
- * @param ths 대상 덱 포인터
+ * @brief __unds_cache_aligned_alloc으로 할당한 공간 해제
+ * @param ptr 해제할 공간의 주소
  */
-void __unds_deque_capacity_correction(unds_deque_t* ths)
+void __unds_cache_aligned_free(void* ptr)
 {
-    size_t correct_capacity = 1;
-
-    while (correct_capacity <= ths->size + 1)
-        correct_capacity *= 2;
+    void* base;
 
-    ths->arr = unds_realloc(ths->arr, correct_capacity * ths->of_size);
-    if (ths->arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to reallocate memory for deque in __unds_deque_capacity_correction().\n");
-        abort();
-    }
+    if (ptr == NULL)
+        return;
 
-    ths->capacity = correct_capacity;
+    memcpy(&base, (char*)ptr - sizeof(void*), sizeof(void*));
+    unds_free(base);
 }
 
-unds_deque_t* unds_deque_create(size_t of_size)
+unds_spsc_queue_t* unds_spsc_queue_create(size_t of_size, size_t capacity)
 {
-    unds_deque_t* ths = (unds_deque_t*)unds_malloc(sizeof(unds_deque_t));
-
-    ths->arr = unds_malloc(of_size);
-    if (ths->arr == NULL)
+    if (of_size == 0)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for deque in unds_deque_create().\n");
+        fprintf(stderr, "stderr: Size of a single element of queue cannot be zero.\n");
         abort();
     }
 
-    ths->capacity = 1;
-    ths->size = 0;
-    ths->of_size = of_size;
-    ths->head = 0;
-    ths->tail = 0;
+    size_t correct_capacity = 1;
 
-    return ths;
-}
+    while (correct_capacity < capacity)
+        correct_capacity *= 2;
 
-unds_deque_t* unds_deque_create_from_array(void* arr, size_t size, size_t of_size)
-{
-    if (arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to initialize deque since the original array is NULL.\n");
-        abort();
-    }
-    else if (of_size == 0)
+    // 생산자와 소비자의 카운터가 다른 캐시 라인에 오도록 구조체를 정렬하여 할당한다.
+    unds_spsc_queue_t* ths = (unds_spsc_queue_t*)__unds_cache_aligned_alloc(sizeof(unds_spsc_queue_t));
+    if (ths == NULL)
     {
-        fprintf(stderr, "stderr: Size of a single element of deque cannot be zero.");
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in unds_spsc_queue_create().\n");
         abort();
     }
 
-    unds_deque_t* ths = (unds_deque_t*)unds_malloc(sizeof(unds_deque_t));
-
-    ths->arr = unds_malloc(size * of_size);
+    ths->arr = __unds_storage_alloc(correct_capacity * of_size);
     if (ths->arr == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for deque in unds_deque_create_from_array().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in unds_spsc_queue_create().\n");
         abort();
     }
 
-    ths->capacity = size;
-    ths->size = size;
+    ths->capacity = correct_capacity;
     ths->of_size = of_size;
-    ths->head = 0;
-    ths->tail = size;
-
-    memcpy(ths->arr, arr, size * of_size);
-    __unds_deque_capacity_correction(ths);
+    atomic_init(&ths->head, 0);
+    atomic_init(&ths->tail, 0);
+    ths->cached_tail = 0;
+    ths->cached_head = 0;
 
     return ths;
 }
 
-unds_deque_t* unds_deque_create_from_value(void* value, size_t size, size_t of_size)
+unds_spsc_queue_t* unds_spsc_queue_create_from_array(void* arr, size_t size, size_t of_size)
 {
-    if (value == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to initialize deque since the original array is NULL.\n");
-        abort();
-    }
-    else if (of_size == 0)
+    if (arr == NULL)
     {
-        fprintf(stderr, "stderr: Size of a single element of deque cannot be zero.");
+        fprintf(stderr, "stderr: Failed to initialize queue since the original array is NULL.\n");
         abort();
     }
 
-    unds_deque_t* ths = (unds_deque_t*)unds_malloc(sizeof(unds_deque_t));
-    ths->arr = unds_malloc(size * of_size);
-    if (ths->arr == NULL)
+    unds_spsc_queue_t* ths = unds_spsc_queue_create(of_size, size);
+    unds_spsc_queue_push_n(ths, arr, size);
+
+    return ths;
+}
+
+unds_spsc_queue_t* unds_spsc_queue_create_from_value(void* value, size_t size, size_t of_size)
+{
+    if (value == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for deque in unds_deque_create_from_array().\n");
+        fprintf(stderr, "stderr: Failed to initialize queue since the original array is NULL.\n");
         abort();
-    }
-
-    ths->capacity = size;
-    ths->size = size;
-    ths->of_size = of_size;
-    ths->head = 0;
-    ths->tail = size;
+    }
+
+    unds_spsc_queue_t* ths = unds_spsc_queue_create(of_size, size);
 
     for (size_t i = 0; i < size; i++)
-        memcpy((char*)ths->arr + i * of_size, value, of_size);
-    __unds_deque_capacity_correction(ths);
-    
+        unds_spsc_queue_try_push(ths, value);
+
     return ths;
 }
 
-void unds_deque_delete(unds_deque_t* ths)
+void unds_spsc_queue_delete(unds_spsc_queue_t* ths)
 {
-    unds_free(ths->arr);
-    unds_free(ths);
+    __unds_storage_free(ths->arr);
+    __unds_cache_aligned_free(ths);
 }
 
-bool unds_deque_empty(unds_deque_t* ths)
+bool unds_spsc_queue_empty(unds_spsc_queue_t* ths)
 {
-    return ths->size == 0;
+    return unds_spsc_queue_size(ths) == 0;
 }
 
-void unds_deque_push_front(unds_deque_t* ths, void* value)
+size_t unds_spsc_queue_size(unds_spsc_queue_t* ths)
 {
-    if (ths->size + 1 == ths->capacity)
-        __unds_deque_double(ths);
-
-    ths->head += ths->capacity - 1;
-    ths->head %= ths->capacity;
+    size_t head = atomic_load_explicit(&ths->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&ths->tail, memory_order_acquire);
 
-    memcpy((char*)ths->arr + ths->head * ths->of_size, value, ths->of_size);
+    return tail - head;
+}
 
-    ths->size++;
+void unds_spsc_queue_clear(unds_spsc_queue_t* ths)
+{
+    atomic_store_explicit(&ths->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ths->tail, 0, memory_order_relaxed);
+    ths->cached_tail = 0;
+    ths->cached_head = 0;
 }
 
-void unds_deque_push_back(unds_deque_t* ths, void* value)
+bool unds_spsc_queue_try_push(unds_spsc_queue_t* ths, void* value)
 {
-    if (ths->size + 1 == ths->capacity)
-        __unds_deque_double(ths);
+    size_t tail = atomic_load_explicit(&ths->tail, memory_order_relaxed);
 
-    memcpy((char*)ths->arr + ths->tail * ths->of_size, value, ths->of_size);
+    if (tail - ths->cached_head == ths->capacity)
+    {
+        ths->cached_head = atomic_load_explicit(&ths->head, memory_order_acquire);
+        if (tail - ths->cached_head == ths->capacity)
+            return false;
+    }
 
-    ths->tail++;
-    ths->tail %= ths->capacity;
+    memcpy((char*)ths->arr + (tail & (ths->capacity - 1)) * ths->of_size, value, ths->of_size);
+    atomic_store_explicit(&ths->tail, tail + 1, memory_order_release);
 
-    ths->size++;
+    return true;
 }
 
-void unds_deque_pop_front(unds_deque_t* ths)
+bool unds_spsc_queue_try_pop(unds_spsc_queue_t* ths, void* dest)
 {
-    if (unds_deque_empty(ths))
+    size_t head = atomic_load_explicit(&ths->head, memory_order_relaxed);
+
+    if (head == ths->cached_tail)
     {
-        fprintf(stderr, "stderr: Failed to pop an element from deque because the deque is empty.\n");
-        abort();
+        ths->cached_tail = atomic_load_explicit(&ths->tail, memory_order_acquire);
+        if (head == ths->cached_tail)
+            return false;
     }
 
-    ths->head++;
-    ths->head %= ths->capacity;
-
-    ths->size--;
+    if (dest != NULL)
+        memcpy(dest, (char*)ths->arr + (head & (ths->capacity - 1)) * ths->of_size, ths->of_size);
+    atomic_store_explicit(&ths->head, head + 1, memory_order_release);
 
-    if (ths->size + 1 == ths->capacity / 2)
-        __unds_deque_half(ths);
+    return true;
 }
 
-void unds_deque_pop_back(unds_deque_t* ths)
+size_t unds_spsc_queue_push_n(unds_spsc_queue_t* ths, void* arr, size_t n)
 {
-    if (unds_deque_empty(ths))
+    size_t tail = atomic_load_explicit(&ths->tail, memory_order_relaxed);
+    size_t room = ths->capacity - (tail - ths->cached_head);
+
+    if (room < n)
     {
-        fprintf(stderr, "stderr: Failed to pop an element from deque because the deque is empty.\n");
-        abort();
+        ths->cached_head = atomic_load_explicit(&ths->head, memory_order_acquire);
+        room = ths->capacity - (tail - ths->cached_head);
     }
 
-    ths->tail += ths->capacity - 1;
-    ths->tail %= ths->capacity;
+    size_t count = n < room ? n : room;
+    if (count == 0)
+        return 0;
 
-    ths->size--;
+    __unds_ring_copy_in(ths->arr, ths->capacity, ths->of_size, tail & (ths->capacity - 1), arr, count);
+    atomic_store_explicit(&ths->tail, tail + count, memory_order_release);
 
-    if (ths->size + 1 == ths->capacity / 2)
-        __unds_deque_half(ths);
+    return count;
 }
 
-void unds_deque_front(unds_deque_t* ths, void* dest)
+size_t unds_spsc_queue_pop_n(unds_spsc_queue_t* ths, void* dest, size_t n)
 {
-    if (unds_deque_empty(ths))
+    size_t head = atomic_load_explicit(&ths->head, memory_order_relaxed);
+    size_t available = ths->cached_tail - head;
+
+    if (available < n)
     {
-        fprintf(stderr, "stderr: Failed to read from the front of the deque because the deque is empty.\n");
-        abort();
+        ths->cached_tail = atomic_load_explicit(&ths->tail, memory_order_acquire);
+        available = ths->cached_tail - head;
     }
 
-    memcpy(dest, (char*)ths->arr + ths->head * ths->of_size, ths->of_size);
-}
+    size_t count = n < available ? n : available;
+    if (count == 0)
+        return 0;
 
-void unds_deque_back(unds_deque_t* ths, void* dest)
-{
-    if (unds_deque_empty(ths))
-    {
-        fprintf(stderr, "stderr: Failed to read from the back of the deque because the deque is empty.\n");
-        abort();
-    }
+    if (dest != NULL)
+        __unds_ring_copy_out(ths->arr, ths->capacity, ths->of_size, head & (ths->capacity - 1), dest, count);
+    atomic_store_explicit(&ths->head, head + count, memory_order_release);
 
-    memcpy(dest, (char*)ths->arr + (ths->tail + ths->capacity - 1) % ths->capacity * ths->of_size, ths->of_size);
+    return count;
 }
 
-void unds_deque_clear(unds_deque_t* ths)
-{
-    ths->arr = unds_realloc(ths->arr, ths->of_size);
-    if (ths->arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to reallocate memory for stack in deque_clear().\n");
-        abort();
-    }
+#ifdef __UNDS_USE_FUTEX
 
-    ths->capacity = 1;
-    ths->size = 0;
-    ths->head = 0;
-    ths->tail = 0;
-}
+/**
+ * unistd.h는 _DEFAULT_SOURCE 없이는 syscall을 선언하지 않으므로(-std=c11 등) 직접 선언한다.
+ */
+long syscall(long number, ...);
 
-unds_hash_map_t* unds_hash_map_create(size_t of_size_key, size_t of_size_value, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q));
+#else
 
 /**
- * *내부 함수
+ * *내부 변수
  *
- * @brief 해시맵의 크기를 두 배로 증가
- * @param ths 대상 해시맵 포인터
+ * futex를 사용할 수 없을 때 대기에 사용하는 뮤텍스
  */
-void __unds_hash_map_double(unds_hash_map_t* ths)
-{
-    unds_list_t** delete_arr = ths->arr;
+pthread_mutex_t __unds_futex_mutex = PTHREAD_MUTEX_INITIALIZER;
 
-    ths->capacity *= 2;
-    ths->size = 0;
+/**
+ * *내부 변수
+ *
+ * futex를 사용할 수 없을 때 대기에 사용하는 조건 변수 (모든 주소가 공유한다.)
+ */
+pthread_cond_t __unds_futex_cond = PTHREAD_COND_INITIALIZER;
 
-    ths->arr = (unds_list_t**)unds_malloc(ths->capacity * sizeof(unds_list_t*));
-    if (ths->arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to allocate memory for hash map in __hash_map_double()\n");
-        abort();
-    }
+#endif
 
-    for (size_t i = 0; i < ths->capacity; i++)
-        ths->arr[i] = unds_list_create(sizeof(unds_pair_t*));
+/**
+ * *내부 함수
+ *
+ * futex를 사용할 수 없으면 전역 조건 변수로 대기한다.
+ * 깨우는 쪽은 값을 바꾼 뒤 같은 뮤텍스를 잡으므로 깨움을 놓치지 않으며, 거짓 깨움은 호출하는 쪽이 처리한다.
+ *
+ * @brief addr의 값이 expected와 같은 동안 대기
+ * @param addr 대기할 값의 주소
+ * @param expected 대기를 시작할 때 읽은 값
+ */
+void __unds_futex_wait(_Atomic unsigned int* addr, unsigned int expected)
+{
+#ifdef __UNDS_USE_FUTEX
+    syscall(SYS_futex, (unsigned int*)addr, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+#else
+    pthread_mutex_lock(&__unds_futex_mutex);
+    if (atomic_load(addr) == expected)
+        pthread_cond_wait(&__unds_futex_cond, &__unds_futex_mutex);
+    pthread_mutex_unlock(&__unds_futex_mutex);
+#endif
+}
 
-    for (size_t i = 0; i < ths->capacity / 2; i++)
-    {
-        for (size_t j = 0; j < delete_arr[i]->size; j++)
-        {
-            unds_pair_t* pair;
-            unds_list_get(delete_arr[i], &pair, j);
-            unds_hash_map_push(ths, pair->first, pair->second);
-            unds_pair_delete(pair);
-        }
-        unds_list_delete(delete_arr[i]);
-    }
-    unds_free(delete_arr);
+/**
+ * *내부 함수
+ *
+ * @brief addr에서 대기 중인 스레드를 최대 count개 깨움
+ * @param addr 대기 중인 값의 주소
+ * @param count 깨울 스레드의 최대 개수
+ */
+void __unds_futex_wake(_Atomic unsigned int* addr, int count)
+{
+#ifdef __UNDS_USE_FUTEX
+    syscall(SYS_futex, (unsigned int*)addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+#else
+    // 모든 주소가 조건 변수를 공유하므로 count와 관계없이 모두 깨운다.
+    (void)addr;
+    (void)count;
+    pthread_mutex_lock(&__unds_futex_mutex);
+    pthread_cond_broadcast(&__unds_futex_cond);
+    pthread_mutex_unlock(&__unds_futex_mutex);
+#endif
 }
 
 /**
  * *내부 함수
  *
- * @brief 해시맵의 크기를 반으로 감소
- * @param ths 대상 해시맵 포인터
+ * 대기하는 스레드가 없으면 공유 변수에 쓰지 않는다.
+ * 대기하는 쪽은 waiters를 늘린 뒤 큐를 다시 확인하므로,
+ * 앞선 울타리에 의해 어느 한쪽은 반드시 상대의 변경을 보게 된다.
+ *
+ * @brief 대기 중인 스레드가 있으면 하나를 깨움
+ * @param event 대기용 값의 주소
+ * @param waiters 대기 중인 스레드의 수의 주소
  */
-void __unds_hash_map_half(unds_hash_map_t* ths)
+void __unds_mpmc_queue_notify(_Atomic unsigned int* event, _Atomic unsigned int* waiters)
 {
-    unds_list_t** delete_arr = ths->arr;
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiters, memory_order_relaxed) == 0)
+        return;
 
-    ths->capacity /= 2;
-    ths->size = 0;
+    atomic_fetch_add_explicit(event, 1, memory_order_release);
+    __unds_futex_wake(event, 1);
+}
 
-    ths->arr = (unds_list_t**)unds_malloc(ths->capacity * sizeof(unds_list_t*));
-    if (ths->arr == NULL)
+unds_mpmc_queue_t* unds_mpmc_queue_create(size_t of_size, size_t capacity)
+{
+    if (of_size == 0)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for hash map in __hash_map_half()\n");
+        fprintf(stderr, "stderr: Size of a single element of queue cannot be zero.\n");
         abort();
     }
 
-    for (size_t i = 0; i < ths->capacity; i++)
-        ths->arr[i] = unds_list_create(sizeof(unds_pair_t*));
+    // 용량이 1이면 삽입된 칸과 삭제된 칸의 순서 번호가 같아지므로 최소 2로 둔다.
+    size_t correct_capacity = 2;
 
-    for (size_t i = 0; i < ths->capacity * 2; i++)
+    while (correct_capacity < capacity)
+        correct_capacity *= 2;
+
+    unds_mpmc_queue_t* ths = (unds_mpmc_queue_t*)__unds_cache_aligned_alloc(sizeof(unds_mpmc_queue_t));
+    if (ths == NULL)
     {
-        for (size_t j = 0; j < delete_arr[i]->size; j++)
-        {
-            unds_pair_t* pair;
-            unds_list_get(delete_arr[i], &pair, j);
-            unds_hash_map_push(ths, pair->first, pair->second);
-            unds_pair_delete(pair);
-        }
-        unds_list_delete(delete_arr[i]);
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in unds_mpmc_queue_create().\n");
+        abort();
     }
-    unds_free(delete_arr);
-}
-
-unds_hash_map_t* unds_hash_map_create(size_t of_size_key, size_t of_size_value, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q))
-{
-    unds_hash_map_t* ths = (unds_hash_map_t*)unds_malloc(sizeof(unds_hash_map_t));
 
-    ths->arr = (unds_list_t**)unds_malloc(21 * sizeof(unds_list_t*));
-    if (ths->arr == NULL)
+    // 칸의 앞에 순서 번호를 두고, 다음 칸의 순서 번호가 정렬되도록 크기를 올림한다.
+    ths->cell_size = (sizeof(size_t) + of_size + sizeof(size_t) - 1) / sizeof(size_t) * sizeof(size_t);
+    ths->cells = __unds_storage_alloc(correct_capacity * ths->cell_size);
+    if (ths->cells == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for hash map in hash_map_create()\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in unds_mpmc_queue_create().\n");
         abort();
     }
 
-    for (int i = 0; i < 21; i++)
-        ths->arr[i] = unds_list_create(sizeof(unds_pair_t*));
-
-    ths->capacity = 21;
-    ths->size = 0;
-    ths->of_size_key = of_size_key;
-    ths->of_size_value = of_size_value;
-
-    ths->hash = hash;
-    ths->comp = comp;
+    ths->capacity = correct_capacity;
+    ths->of_size = of_size;
+    atomic_init(&ths->not_empty, 0);
+    atomic_init(&ths->not_empty_waiters, 0);
+    atomic_init(&ths->not_full, 0);
+    atomic_init(&ths->not_full_waiters, 0);
+    unds_mpmc_queue_clear(ths);
 
     return ths;
 }
 
-void unds_hash_map_delete(unds_hash_map_t* ths)
+unds_mpmc_queue_t* unds_mpmc_queue_create_from_array(void* arr, size_t size, size_t of_size)
 {
-    for (size_t i = 0; i < ths->capacity; i++)
+    if (arr == NULL)
     {
-        for (size_t j = 0; j < ths->arr[i]->size; j++)
-            unds_pair_delete(((unds_pair_t**)ths->arr[i]->arr)[j]);
-        unds_list_delete(ths->arr[i]);
+        fprintf(stderr, "stderr: Failed to initialize queue since the original array is NULL.\n");
+        abort();
     }
-    unds_free(ths->arr);
-    unds_free(ths);
-}
 
-float unds_hash_map_get_load_factor(unds_hash_map_t* ths)
-{
-    return (float)ths->size / ths->capacity;
-}
+    unds_mpmc_queue_t* ths = unds_mpmc_queue_create(of_size, size);
 
-void unds_hash_map_push(unds_hash_map_t* ths, void* key, void* value)
-{
-    if (unds_hash_map_get_load_factor(ths) > 0.7)
-        __unds_hash_map_double(ths);
+    for (size_t i = 0; i < size; i++)
+        unds_mpmc_queue_try_push(ths, (char*)arr + i * of_size);
 
-    size_t index = ths->hash(key) % ths->capacity;
+    return ths;
+}
 
-    for (size_t i = 0; i < ths->arr[index]->size; i++)
+unds_mpmc_queue_t* unds_mpmc_queue_create_from_value(void* value, size_t size, size_t of_size)
+{
+    if (value == NULL)
     {
-        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
-        if (ths->comp(key, pair->first) == 0)
-        {
-            return;
-        }
+        fprintf(stderr, "stderr: Failed to initialize queue since the original array is NULL.\n");
+        abort();
     }
 
-    unds_pair_t* pair = unds_pair_make(key, ths->of_size_key, value, ths->of_size_value);
-    unds_list_push(ths->arr[index], &pair);
+    unds_mpmc_queue_t* ths = unds_mpmc_queue_create(of_size, size);
 
-    ths->size++;
+    for (size_t i = 0; i < size; i++)
+        unds_mpmc_queue_try_push(ths, value);
+
+    return ths;
 }
 
-void unds_hash_map_pop(unds_hash_map_t* ths, void* key)
+void unds_mpmc_queue_delete(unds_mpmc_queue_t* ths)
 {
-    size_t index = ths->hash(key) % ths->capacity;
+    __unds_storage_free(ths->cells);
+    __unds_cache_aligned_free(ths);
+}
 
-    for (size_t i = 0; i < ths->arr[index]->size; i++)
-    {
-        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
-        if (ths->comp(key, pair->first) == 0)
-        {
-            unds_pair_delete(pair);
-            unds_list_remove(ths->arr[index], i);
-            ths->size--;
+bool unds_mpmc_queue_empty(unds_mpmc_queue_t* ths)
+{
+    return unds_mpmc_queue_size(ths) == 0;
+}
 
-            if (ths->capacity > 21 && unds_hash_map_get_load_factor(ths) < 0.3)
-                __unds_hash_map_half(ths);
+size_t unds_mpmc_queue_size(unds_mpmc_queue_t* ths)
+{
+    size_t head = atomic_load_explicit(&ths->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&ths->tail, memory_order_acquire);
 
-            return;
-        }
-    }
+    // 삭제를 예약한 소비자가 삽입을 마치지 않은 칸을 앞질러 있을 수 있다.
+    return tail > head ? tail - head : 0;
+}
 
-    fprintf(stderr, "stderr: Failed to pop an element from hash map because key is invalid.\n");
-    abort();
+void unds_mpmc_queue_clear(unds_mpmc_queue_t* ths)
+{
+    for (size_t i = 0; i < ths->capacity; i++)
+        atomic_init((_Atomic size_t*)((char*)ths->cells + i * ths->cell_size), i);
+
+    atomic_store_explicit(&ths->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ths->tail, 0, memory_order_relaxed);
 }
 
-void unds_hash_map_get(unds_hash_map_t* ths, void* dest, void* key)
+bool unds_mpmc_queue_try_push(unds_mpmc_queue_t* ths, void* value)
 {
-    size_t index = ths->hash(key) % ths->capacity;
+    size_t pos = atomic_load_explicit(&ths->tail, memory_order_relaxed);
+    char* cell;
 
-    for (size_t i = 0; i < ths->arr[index]->size; i++)
+    for (;;)
     {
-        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
-        if (ths->comp(key, pair->first) == 0)
+        cell = (char*)ths->cells + (pos & (ths->capacity - 1)) * ths->cell_size;
+        size_t seq = atomic_load_explicit((_Atomic size_t*)cell, memory_order_acquire);
+        intptr_t diff = (intptr_t)(seq - pos);
+
+        if (diff == 0)
         {
-            memcpy(dest, pair->second, ths->of_size_value);
-            return;
+            if (atomic_compare_exchange_weak_explicit(&ths->tail, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+                break;
         }
+        // 한 바퀴 전의 요소가 아직 삭제되지 않았다.
+        else if (diff < 0)
+            return false;
+        else
+            pos = atomic_load_explicit(&ths->tail, memory_order_relaxed);
     }
 
-    fprintf(stderr, "stderr: Failed to read an element from hash map because key is invalid.\n");
-    abort();
+    memcpy(cell + sizeof(size_t), value, ths->of_size);
+    atomic_store_explicit((_Atomic size_t*)cell, pos + 1, memory_order_release);
+    __unds_mpmc_queue_notify(&ths->not_empty, &ths->not_empty_waiters);
+
+    return true;
 }
 
-void unds_hash_map_set(unds_hash_map_t* ths, void* key, void* value)
+bool unds_mpmc_queue_try_pop(unds_mpmc_queue_t* ths, void* dest)
 {
-    size_t index = ths->hash(key) % ths->capacity;
+    size_t pos = atomic_load_explicit(&ths->head, memory_order_relaxed);
+    char* cell;
 
-    for (size_t i = 0; i < ths->arr[index]->size; i++)
+    for (;;)
     {
-        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
-        if (ths->comp(key, pair->first) == 0)
+        cell = (char*)ths->cells + (pos & (ths->capacity - 1)) * ths->cell_size;
+        size_t seq = atomic_load_explicit((_Atomic size_t*)cell, memory_order_acquire);
+        intptr_t diff = (intptr_t)(seq - (pos + 1));
+
+        if (diff == 0)
         {
-            unds_pair_set_second(pair, value);
-            return;
+            if (atomic_compare_exchange_weak_explicit(&ths->head, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+                break;
         }
+        // 아직 삽입이 끝나지 않았다.
+        else if (diff < 0)
+            return false;
+        else
+            pos = atomic_load_explicit(&ths->head, memory_order_relaxed);
     }
 
-    fprintf(stderr, "stderr: Failed to set an element in hash map because key is invalid.\n");
-    abort();
+    if (dest != NULL)
+        memcpy(dest, cell + sizeof(size_t), ths->of_size);
+    atomic_store_explicit((_Atomic size_t*)cell, pos + ths->capacity, memory_order_release);
+    __unds_mpmc_queue_notify(&ths->not_full, &ths->not_full_waiters);
+
+    return true;
 }
 
-bool unds_hash_map_has(unds_hash_map_t* ths, void* key)
+void unds_mpmc_queue_push(unds_mpmc_queue_t* ths, void* value)
 {
-    size_t index = ths->hash(key) % ths->capacity;
-
-    for (size_t i = 0; i < ths->arr[index]->size; i++)
+    while (!unds_mpmc_queue_try_push(ths, value))
     {
-        unds_pair_t* pair = ((unds_pair_t**)ths->arr[index]->arr)[i];
-        if (ths->comp(key, pair->first) == 0)
-            return true;
-    }
+        atomic_fetch_add_explicit(&ths->not_full_waiters, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        unsigned int event = atomic_load_explicit(&ths->not_full, memory_order_acquire);
+        if (unds_mpmc_queue_try_push(ths, value))
+        {
+            atomic_fetch_sub_explicit(&ths->not_full_waiters, 1, memory_order_relaxed);
+            return;
+        }
 
-    return false;
+        __unds_futex_wait(&ths->not_full, event);
+        atomic_fetch_sub_explicit(&ths->not_full_waiters, 1, memory_order_relaxed);
+    }
 }
 
-void unds_hash_map_clear(unds_hash_map_t* ths)
+void unds_mpmc_queue_pop(unds_mpmc_queue_t* ths, void* dest)
 {
-    for (size_t i = 0; i < ths->capacity; i++)
+    while (!unds_mpmc_queue_try_pop(ths, dest))
     {
-        size_t iter = ths->arr[i]->size;
-        for (size_t j = 0; j < iter; j++)
+        atomic_fetch_add_explicit(&ths->not_empty_waiters, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        unsigned int event = atomic_load_explicit(&ths->not_empty, memory_order_acquire);
+        if (unds_mpmc_queue_try_pop(ths, dest))
         {
-            unds_pair_t* pair = ((unds_pair_t**)ths->arr[i]->arr)[j];
-            unds_hash_map_pop(ths, pair->first);
+            atomic_fetch_sub_explicit(&ths->not_empty_waiters, 1, memory_order_relaxed);
+            return;
         }
+
+        __unds_futex_wait(&ths->not_empty, event);
+        atomic_fetch_sub_explicit(&ths->not_empty_waiters, 1, memory_order_relaxed);
     }
 }
 
 /**
- * *내부 변수.
- *
- * 내부 true
- */
-bool __unds_true = true;
-/**
- * *내부 변수.
+ * *내부 함수
  *
- * 내부 false
+ * @brief 작업 훔치기 덱의 원형 배열 할당
+ * @param capacity 배열의 용량 (2의 제곱수)
+ * @return 할당한 배열의 주소
  */
-bool __unds_false = false;
+struct __unds_work_stealing_array_t* __unds_work_stealing_array_create(size_t capacity)
+{
+    struct __unds_work_stealing_array_t* array = (struct __unds_work_stealing_array_t*)unds_malloc(
+        sizeof(struct __unds_work_stealing_array_t) + capacity * sizeof(_Atomic(void*)));
+    if (array == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for deque in __unds_work_stealing_array_create().\n");
+        abort();
+    }
+
+    array->capacity = capacity;
+    array->prev = NULL;
+
+    return array;
+}
 
 /**
- * *내부 함수.
- * 
- * @brief 해시셋의 속성을 해시맵과 동기화
- * @param ths 대상 해시셋 포인터
+ * *내부 함수
+ *
+ * 이전 배열은 아직 읽고 있는 도둑 스레드가 있을 수 있으므로 해제하지 않는다.
+ *
+ * @brief 작업 훔치기 덱의 용량을 두 배로 늘림 (소유자 전용)
+ * @param ths 대상 덱 포인터
+ * @param array 현재 배열
+ * @param top 현재 top
+ * @param bottom 현재 bottom
+ * @return 새 배열
  */
-void __unds_hash_set_update_variables(unds_hash_set_t* ths)
+struct __unds_work_stealing_array_t* __unds_work_stealing_deque_grow(unds_work_stealing_deque_t* ths,
+                                                                     struct __unds_work_stealing_array_t* array,
+                                                                     intptr_t top, intptr_t bottom)
 {
-    ths->capacity = ths->map->capacity;
-    ths->size = ths->map->size;
-    ths->of_size = ths->map->of_size_key;
+    struct __unds_work_stealing_array_t* grown = __unds_work_stealing_array_create(array->capacity * 2);
 
-    ths->hash = ths->map->hash;
-    ths->comp = ths->map->comp;
+    for (intptr_t i = top; i < bottom; i++)
+        atomic_store_explicit(&grown->items[(size_t)i & (grown->capacity - 1)],
+                              atomic_load_explicit(&array->items[(size_t)i & (array->capacity - 1)],
+                                                   memory_order_relaxed),
+                              memory_order_relaxed);
+
+    grown->prev = array;
+    atomic_store_explicit(&ths->array, grown, memory_order_release);
+
+    return grown;
 }
 
-unds_hash_set_t* unds_hash_set_create(size_t of_size, size_t (*hash)(const void *p), int (*comp)(const void* p, const void* q))
+unds_work_stealing_deque_t* unds_work_stealing_deque_create(size_t capacity)
 {
-    unds_hash_set_t* ths = (unds_hash_set_t*)unds_malloc(sizeof(unds_hash_set_t));
+    size_t correct_capacity = 1;
 
-    ths->map = unds_hash_map_create(of_size, sizeof(bool), hash, comp);
+    while (correct_capacity < capacity)
+        correct_capacity *= 2;
 
-    __unds_hash_set_update_variables(ths);
+    unds_work_stealing_deque_t* ths =
+        (unds_work_stealing_deque_t*)__unds_cache_aligned_alloc(sizeof(unds_work_stealing_deque_t));
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for deque in unds_work_stealing_deque_create().\n");
+        abort();
+    }
+
+    atomic_init(&ths->top, 0);
+    atomic_init(&ths->bottom, 0);
+    atomic_init(&ths->array, __unds_work_stealing_array_create(correct_capacity));
 
     return ths;
 }
 
-void unds_hash_set_delete(unds_hash_set_t* ths)
+void unds_work_stealing_deque_delete(unds_work_stealing_deque_t* ths)
 {
-    unds_hash_map_delete(ths->map);
-    unds_free(ths);
-}
+    struct __unds_work_stealing_array_t* array = atomic_load_explicit(&ths->array, memory_order_relaxed);
 
-void unds_hash_set_push(unds_hash_set_t* ths, void* elem)
-{
-    unds_hash_map_push(ths->map, elem, &__unds_true);
+    while (array != NULL)
+    {
+        struct __unds_work_stealing_array_t* prev = array->prev;
+        unds_free(array);
+        array = prev;
+    }
 
-    __unds_hash_set_update_variables(ths);
+    __unds_cache_aligned_free(ths);
 }
 
-void unds_hash_set_pop(unds_hash_set_t* ths, void* elem)
+size_t unds_work_stealing_deque_size(unds_work_stealing_deque_t* ths)
 {
-    unds_hash_map_pop(ths->map, elem);
+    intptr_t bottom = atomic_load_explicit(&ths->bottom, memory_order_acquire);
+    intptr_t top = atomic_load_explicit(&ths->top, memory_order_acquire);
 
-    __unds_hash_set_update_variables(ths);
+    return bottom > top ? (size_t)(bottom - top) : 0;
 }
 
-bool unds_hash_set_has(unds_hash_set_t* ths, void* elem)
+bool unds_work_stealing_deque_empty(unds_work_stealing_deque_t* ths)
 {
-    return unds_hash_map_has(ths->map, elem);
+    return unds_work_stealing_deque_size(ths) == 0;
 }
 
-void unds_hash_set_clear(unds_hash_set_t* ths)
+void unds_work_stealing_deque_push(unds_work_stealing_deque_t* ths, void* item)
 {
-    unds_hash_map_clear(ths->map);
+    intptr_t bottom = atomic_load_explicit(&ths->bottom, memory_order_relaxed);
+    intptr_t top = atomic_load_explicit(&ths->top, memory_order_acquire);
+    struct __unds_work_stealing_array_t* array = atomic_load_explicit(&ths->array, memory_order_relaxed);
 
-    __unds_hash_set_update_variables(ths);
+    if ((size_t)(bottom - top) >= array->capacity)
+        array = __unds_work_stealing_deque_grow(ths, array, top, bottom);
+
+    atomic_store_explicit(&array->items[(size_t)bottom & (array->capacity - 1)], item, memory_order_relaxed);
+    atomic_store_explicit(&ths->bottom, bottom + 1, memory_order_release);
 }
 
-/**
- * *내부 함수
- *
- * @brief 힙큐 크기 2배 증가
- * @param ths 대상 힙큐 포인터
- */
-void __unds_heap_queue_double(unds_heap_queue_t* ths)
+void* unds_work_stealing_deque_pop(unds_work_stealing_deque_t* ths)
 {
-    ths->capacity *= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
-    if (ths->arr == NULL)
+    intptr_t bottom = atomic_load_explicit(&ths->bottom, memory_order_relaxed) - 1;
+    struct __unds_work_stealing_array_t* array = atomic_load_explicit(&ths->array, memory_order_relaxed);
+
+    // bottom을 먼저 줄여 도둑 스레드가 마지막 요소를 가져가지 못하게 한 뒤 top을 확인한다.
+    atomic_store_explicit(&ths->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    intptr_t top = atomic_load_explicit(&ths->top, memory_order_relaxed);
+
+    if (top > bottom)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for heap_queue in __heap_queue_double().\n");
-        abort();
+        atomic_store_explicit(&ths->bottom, bottom + 1, memory_order_relaxed);
+        return NULL;
     }
-}
 
-/**
- * *내부 함수
- *
- * @brief 힙큐 크기 2배 감소
- * @param ths 대상 힙큐 포인터
- */
-void __unds_heap_queue_half(unds_heap_queue_t* ths)
-{
-    if (ths->size == 0)
-        return;
+    void* item = atomic_load_explicit(&array->items[(size_t)bottom & (array->capacity - 1)], memory_order_relaxed);
 
-    ths->capacity /= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
-    if (ths->arr == NULL)
+    // 마지막 요소는 도둑 스레드와 top을 두고 경쟁한다.
+    if (top == bottom)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for heap_queue in __heap_queue_half().\n");
-        abort();
+        if (!atomic_compare_exchange_strong_explicit(&ths->top, &top, top + 1, memory_order_seq_cst,
+                                                     memory_order_relaxed))
+            item = NULL;
+        atomic_store_explicit(&ths->bottom, bottom + 1, memory_order_relaxed);
     }
+
+    return item;
 }
 
-/**
- * *내부 함수
- *
- * @brief 힙큐의 크기를 2의 제곱수로 교정
- * @param ths 대상 힙큐 포인터
- */
-void __unds_heap_queue_capacity_correction(unds_heap_queue_t* ths)
+void* unds_work_stealing_deque_steal(unds_work_stealing_deque_t* ths)
 {
-    size_t correct_capacity = 1;
+    intptr_t top = atomic_load_explicit(&ths->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    intptr_t bottom = atomic_load_explicit(&ths->bottom, memory_order_acquire);
 
-    while (correct_capacity <= ths->size)
-        correct_capacity *= 2;
+    if (top >= bottom)
+        return NULL;
 
-    ths->arr = unds_realloc(ths->arr, correct_capacity * ths->of_size);
-    if (ths->arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to reallocate memory for stack in __heap_queue_capacity_correction().\n");
-        abort();
-    }
+    struct __unds_work_stealing_array_t* array = atomic_load_explicit(&ths->array, memory_order_acquire);
+    void* item = atomic_load_explicit(&array->items[(size_t)top & (array->capacity - 1)], memory_order_relaxed);
 
-    ths->capacity = correct_capacity;
+    if (!atomic_compare_exchange_strong_explicit(&ths->top, &top, top + 1, memory_order_seq_cst,
+                                                 memory_order_relaxed))
+        return NULL;
+
+    return item;
 }
 
 /**
- * *내부 함수
- * 
- * @brief 특정 인덱스에 대한 왼쪽 자식 요소의 인덱스 계산
- * @param index 왼쪽 자식 요소를 계산할 부모 요소의 인덱스
- * @return 왼쪽 자식 요소의 인덱스
+ * *내부 자료형
+ *
+ * 작업 풀에 제출된 작업 하나
  */
-size_t __unds_heap_queue_get_left_child(size_t index)
+struct __unds_task_t
 {
-    return 2 * index + 1;
-}
+    unds_task_func_t func;
+    void* arg;
+};
 
 /**
- * *내부 함수
- * 
- * @brief 특정 인덱스에 대한 부모 요소의 인덱스 계산
- * @param index 부모 요소를 계산할 자식 요소의 인덱스
- * @return 부모 요소의 인덱스
+ * *내부 변수
+ *
+ * 현재 스레드가 작업자 스레드이면 그 작업자의 상태, 아니면 NULL
  */
-size_t __unds_heap_queue_get_parent(size_t index)
-{
-    if (index == 0)
-        return 0;
-    return (index - 1) / 2;
-}
+_Thread_local struct __unds_task_worker_t* __unds_task_current_worker = NULL;
 
 /**
  * *내부 함수
- * 
- * @brief 특정 요소에 대해서 최상위 노드 방향으로 힙큐의 배열을 힙으로 변환
- * @param ths 대상 힙큐 포인터
- * @param index 힙으로 변환할 기준이 되는 요소의 인덱스
+ *
+ * 자신의 덱, 공용 큐, 다른 작업자의 덱 순서로 찾는다.
+ *
+ * @brief 작업자가 실행할 다음 작업을 찾음
+ * @param worker 대상 작업자
+ * @return 찾은 작업 (없으면 NULL)
  */
-void __unds_heap_queue_reheap_up(unds_heap_queue_t* ths, size_t index)
+struct __unds_task_t* __unds_task_pool_find(struct __unds_task_worker_t* worker)
 {
-    size_t node = index;
-    size_t parent = __unds_heap_queue_get_parent(node);
+    unds_task_pool_t* pool = worker->pool;
+    struct __unds_task_t* task = (struct __unds_task_t*)unds_work_stealing_deque_pop(worker->deque);
 
-    while (index > 0)
+    if (task != NULL)
+        return task;
+
+    if (atomic_load_explicit(&pool->injected, memory_order_relaxed) > 0)
     {
-        if (ths->comp((char*)ths->arr + node * ths->of_size, (char*)ths->arr + parent * ths->of_size) != -1)
-            break;
+        pthread_mutex_lock(&pool->mutex);
+        if (!unds_queue_empty(pool->injector))
+        {
+            unds_queue_front(pool->injector, &task);
+            unds_queue_pop(pool->injector);
+            atomic_fetch_sub_explicit(&pool->injected, 1, memory_order_relaxed);
+        }
+        pthread_mutex_unlock(&pool->mutex);
 
-        void* temp = unds_malloc(ths->of_size);
-        memcpy(temp, (char*)ths->arr + node * ths->of_size, ths->of_size);
-        memcpy((char*)ths->arr + node * ths->of_size, (char*)ths->arr + parent * ths->of_size, ths->of_size);
-        memcpy((char*)ths->arr + parent * ths->of_size, temp, ths->of_size);
-        unds_free(temp);
+        if (task != NULL)
+            return task;
+    }
 
-        node = parent;
-        parent = __unds_heap_queue_get_parent(node);
+    // 매번 같은 작업자부터 훔치지 않도록 임의의 작업자부터 한 바퀴 돈다.
+    worker->seed ^= worker->seed << 13;
+    worker->seed ^= worker->seed >> 17;
+    worker->seed ^= worker->seed << 5;
+
+    size_t start = worker->seed % pool->num_workers;
+    for (size_t i = 0; i < pool->num_workers && task == NULL; i++)
+    {
+        struct __unds_task_worker_t* victim = &pool->workers[(start + i) % pool->num_workers];
+        if (victim != worker)
+            task = (struct __unds_task_t*)unds_work_stealing_deque_steal(victim->deque);
     }
+
+    return task;
 }
 
 /**
  * *내부 함수
- * 
- * @brief 특정 요소에 대해서 최하위 노드 방향으로 힙큐의 배열을 힙으로 변환
- * @param ths 대상 힙큐 포인터
- * @param index 힙으로 변환할 기준이 되는 요소의 인덱스
+ *
+ * @brief 작업을 실행하고 끝난 작업으로 처리
+ * @param pool 대상 작업 풀
+ * @param task 실행할 작업
  */
-void __unds_heap_queue_reheap_down(unds_heap_queue_t* ths, size_t index)
+void __unds_task_pool_run(unds_task_pool_t* pool, struct __unds_task_t* task)
 {
-    size_t node = index;
-    size_t child = __unds_heap_queue_get_left_child(index);
+    task->func(pool, task->arg);
+    unds_free(task);
 
-    while (child < ths->size)
+    if (atomic_fetch_sub_explicit(&pool->pending, 1, memory_order_acq_rel) == 1)
     {
-        int comp_result = -1;
-        if (child + 1 < ths->size)
-            comp_result = ths->comp((char*)ths->arr + child * ths->of_size, (char*)ths->arr + (child + 1) * ths->of_size);
-
-        int higher_priority = comp_result == -1 ? child : child + 1;
-
-        if (ths->comp((char*)ths->arr + higher_priority * ths->of_size, (char*)ths->arr + node * ths->of_size) != -1)
-            break;
-
-        void* temp = unds_malloc(ths->of_size);
-        memcpy(temp, (char*)ths->arr + higher_priority * ths->of_size, ths->of_size);
-        memcpy((char*)ths->arr + higher_priority * ths->of_size, (char*)ths->arr + node * ths->of_size, ths->of_size);
-        memcpy((char*)ths->arr + node * ths->of_size, temp, ths->of_size);
-        unds_free(temp);
-
-        node = higher_priority;
-        child = __unds_heap_queue_get_left_child(node);
+        pthread_mutex_lock(&pool->mutex);
+        pthread_cond_broadcast(&pool->done_cond);
+        pthread_mutex_unlock(&pool->mutex);
     }
 }
 
 /**
  * *내부 함수
- * 
- * @brief 힙큐의 배열을 힙으로 변환
- * @param ths 대상 힙큐 포인터
+ *
+ * 실행할 작업을 찾지 못하면 새 작업이 제출될 때까지 잠든다.
+ *
+ * @brief 작업자 스레드의 시작 함수
+ * @param arg 작업자의 상태
+ * @return NULL
  */
-void __unds_heap_queue_heapify(unds_heap_queue_t* ths)
+void* __unds_task_pool_worker(void* arg)
 {
-    if (ths->size == 0)
-        return;
+    struct __unds_task_worker_t* worker = (struct __unds_task_worker_t*)arg;
+    unds_task_pool_t* pool = worker->pool;
 
-    size_t index = ths->size - 1;
-    if (index % 2 == 1)
-        index++;
+    __unds_task_current_worker = worker;
 
-    while (index > 0)
+    for (;;)
     {
-        size_t parent = __unds_heap_queue_get_parent(index);
-        __unds_heap_queue_reheap_down(ths, parent);
-        index -= 2;
+        // 찾기 전에 번호를 읽어 두어, 찾는 도중에 제출된 작업이 있으면 잠들지 않는다.
+        unsigned int seq = atomic_load(&pool->work_seq);
+        struct __unds_task_t* task = __unds_task_pool_find(worker);
+
+        if (task != NULL)
+        {
+            __unds_task_pool_run(pool, task);
+            continue;
+        }
+
+        // sleepers를 늘린 뒤 work_seq를 확인하므로, 제출하는 쪽과 둘 중 하나는 반드시 상대를 본다.
+        pthread_mutex_lock(&pool->mutex);
+        atomic_fetch_add(&pool->sleepers, 1);
+        while (atomic_load(&pool->work_seq) == seq && !atomic_load_explicit(&pool->stop, memory_order_relaxed))
+            pthread_cond_wait(&pool->work_cond, &pool->mutex);
+        atomic_fetch_sub(&pool->sleepers, 1);
+        pthread_mutex_unlock(&pool->mutex);
+
+        if (atomic_load_explicit(&pool->stop, memory_order_relaxed) &&
+            atomic_load_explicit(&pool->pending, memory_order_acquire) == 0)
+            break;
     }
+
+    __unds_task_current_worker = NULL;
+
+    return NULL;
 }
 
-unds_heap_queue_t* unds_heap_queue_create(size_t of_size, int (*comp)(const void* p, const void* q))
+unds_task_pool_t* unds_task_pool_create(size_t num_threads)
 {
-    unds_heap_queue_t* ths = (unds_heap_queue_t*)unds_malloc(sizeof(unds_heap_queue_t));
+    if (num_threads == 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = online > 0 ? (size_t)online : 1;
+    }
 
-    ths->arr = unds_malloc(of_size);
-    if (ths->arr == NULL)
+    unds_task_pool_t* ths = (unds_task_pool_t*)unds_malloc(sizeof(unds_task_pool_t));
+    if (ths == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for heap queue in heap_queue_create()\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for task pool in unds_task_pool_create().\n");
         abort();
     }
 
-    ths->capacity = 1;
-    ths->size = 0;
-    ths->of_size = of_size;
-    ths->comp = comp;
+    ths->workers = (struct __unds_task_worker_t*)unds_malloc(num_threads * sizeof(struct __unds_task_worker_t));
+    if (ths->workers == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for task pool in unds_task_pool_create().\n");
+        abort();
+    }
+
+    ths->num_workers = num_threads;
+    ths->injector = unds_queue_create(sizeof(struct __unds_task_t*));
+    pthread_mutex_init(&ths->mutex, NULL);
+    pthread_cond_init(&ths->work_cond, NULL);
+    pthread_cond_init(&ths->done_cond, NULL);
+    atomic_init(&ths->pending, 0);
+    atomic_init(&ths->injected, 0);
+    atomic_init(&ths->work_seq, 0);
+    atomic_init(&ths->sleepers, 0);
+    atomic_init(&ths->stop, false);
+
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        ths->workers[i].deque = unds_work_stealing_deque_create(64);
+        ths->workers[i].pool = ths;
+        ths->workers[i].seed = (uint32_t)(i * 2654435761u) | 1;
+    }
+
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        if (pthread_create(&ths->workers[i].thread, NULL, __unds_task_pool_worker, &ths->workers[i]) != 0)
+        {
+            fprintf(stderr, "stderr: Failed to create a thread in unds_task_pool_create().\n");
+            abort();
+        }
+    }
 
     return ths;
 }
 
-unds_heap_queue_t* unds_heap_queue_create_from_array(void* arr, size_t size, size_t of_size, int (*comp)(const void* p, const void* q))
+void unds_task_pool_delete(unds_task_pool_t* ths)
 {
-    if (arr == NULL)
+    unds_task_pool_wait(ths);
+
+    pthread_mutex_lock(&ths->mutex);
+    atomic_store_explicit(&ths->stop, true, memory_order_relaxed);
+    pthread_cond_broadcast(&ths->work_cond);
+    pthread_mutex_unlock(&ths->mutex);
+
+    // 다른 작업자가 아직 훔치려고 덱을 읽고 있을 수 있으므로 모두 종료된 뒤에 덱을 삭제한다.
+    for (size_t i = 0; i < ths->num_workers; i++)
+        pthread_join(ths->workers[i].thread, NULL);
+    for (size_t i = 0; i < ths->num_workers; i++)
+        unds_work_stealing_deque_delete(ths->workers[i].deque);
+
+    pthread_cond_destroy(&ths->done_cond);
+    pthread_cond_destroy(&ths->work_cond);
+    pthread_mutex_destroy(&ths->mutex);
+    unds_queue_delete(ths->injector);
+    unds_free(ths->workers);
+    unds_free(ths);
+}
+
+void unds_task_pool_submit(unds_task_pool_t* ths, unds_task_func_t func, void* arg)
+{
+    struct __unds_task_t* task = (struct __unds_task_t*)unds_malloc(sizeof(struct __unds_task_t));
+    if (task == NULL)
     {
-        fprintf(stderr, "stderr: Failed to initialize heap_queue since the original array is NULL.\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for task in unds_task_pool_submit().\n");
         abort();
     }
-    else if (of_size == 0)
+
+    task->func = func;
+    task->arg = arg;
+
+    atomic_fetch_add_explicit(&ths->pending, 1, memory_order_acq_rel);
+    struct __unds_task_worker_t* worker = __unds_task_current_worker;
+
+    if (worker != NULL && worker->pool == ths)
+        unds_work_stealing_deque_push(worker->deque, task);
+    else
     {
-        fprintf(stderr, "stderr: Size of a single element of heap_queue cannot be zero.");
-        abort();
+        pthread_mutex_lock(&ths->mutex);
+        unds_queue_push(ths->injector, &task);
+        atomic_fetch_add_explicit(&ths->injected, 1, memory_order_relaxed);
+        pthread_mutex_unlock(&ths->mutex);
     }
 
-    unds_heap_queue_t* ths = (unds_heap_queue_t*)unds_malloc(sizeof(unds_heap_queue_t));
-
-    ths->arr = unds_malloc(size * of_size);
-    if (ths->arr == NULL)
+    // 훔치거나 꺼낼 작업이 생겼으므로 잠든 작업자가 있으면 하나를 깨운다.
+    atomic_fetch_add(&ths->work_seq, 1);
+    if (atomic_load(&ths->sleepers) > 0)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for heap_queue in heap_queue_create_from_array().\n");
-        abort();
+        pthread_mutex_lock(&ths->mutex);
+        pthread_cond_signal(&ths->work_cond);
+        pthread_mutex_unlock(&ths->mutex);
     }
+}
 
-    ths->capacity = size;
-    ths->size = size;
-    ths->of_size = of_size;
-    ths->comp = comp;
+void unds_task_pool_wait(unds_task_pool_t* ths)
+{
+    pthread_mutex_lock(&ths->mutex);
+    while (atomic_load_explicit(&ths->pending, memory_order_acquire) > 0)
+        pthread_cond_wait(&ths->done_cond, &ths->mutex);
+    pthread_mutex_unlock(&ths->mutex);
+}
 
-    memcpy(ths->arr, arr, size * of_size);
-    __unds_heap_queue_capacity_correction(ths);
-    __unds_heap_queue_heapify(ths);
+/**
+ * *내부 함수
+ *
+ * @brief 지금부터 timeout_ms 뒤의 시각을 조건 변수의 시계 기준으로 계산
+ * @param deadline 계산한 시각을 저장할 곳
+ * @param timeout_ms 지금부터의 시간 (밀리초)
+ */
+void __unds_blocking_queue_deadline(struct timespec* deadline, size_t timeout_ms)
+{
+#ifdef __UNDS_USE_MONOTONIC_COND
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+#else
+    timespec_get(deadline, TIME_UTC);
+#endif
+
+    deadline->tv_sec += (time_t)(timeout_ms / 1000);
+    deadline->tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if (deadline->tv_nsec >= 1000000000)
+    {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000;
+    }
+}
+
+/**
+ * *내부 함수
+ *
+ * 잠금을 잡은 상태에서 호출해야 한다.
+ *
+ * @brief 블로킹 큐의 앞부분의 요소를 꺼내고 빈 자리를 기다리는 스레드를 깨움
+ * @param ths 대상 큐 포인터
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ */
+void __unds_blocking_queue_take(unds_blocking_queue_t* ths, void* dest)
+{
+    if (dest != NULL)
+        unds_queue_front(ths->queue, dest);
+    unds_queue_pop(ths->queue);
 
-    return ths;
+    if (ths->push_waiters > 0)
+        pthread_cond_signal(&ths->not_full);
 }
 
-unds_heap_queue_t* unds_heap_queue_create_from_value(void* value, size_t size, size_t of_size, int (*comp)(const void* p, const void* q))
+unds_blocking_queue_t* unds_blocking_queue_create(size_t of_size, size_t capacity)
 {
-    if (value == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to initialize heap_queue since the original array is NULL.\n");
-        abort();
-    }
-    else if (of_size == 0)
+    if (capacity == 0)
     {
-        fprintf(stderr, "stderr: Size of a single element of heap_queue cannot be zero.");
+        fprintf(stderr, "stderr: Capacity of blocking queue cannot be zero.\n");
         abort();
     }
 
-    unds_heap_queue_t* ths = (unds_heap_queue_t*)unds_malloc(sizeof(unds_heap_queue_t));
-    ths->arr = unds_malloc(size * of_size);
-    if (ths->arr == NULL)
+    unds_blocking_queue_t* ths = (unds_blocking_queue_t*)unds_malloc(sizeof(unds_blocking_queue_t));
+    if (ths == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for heap_queue in heap_queue_create_from_array().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for queue in unds_blocking_queue_create().\n");
         abort();
     }
 
-    ths->capacity = size;
-    ths->size = size;
-    ths->of_size = of_size;
-    ths->comp = comp;
+    // 내장 공간을 용량 이상의 2의 제곱수로 잡아, 가득 찼다가 비워져도 다시 할당하지 않도록 한다.
+    size_t inline_capacity = 1;
+
+    while (inline_capacity < capacity)
+        inline_capacity *= 2;
+
+    ths->queue = unds_queue_create_inline(of_size, inline_capacity);
+    ths->capacity = capacity;
+    ths->pop_waiters = 0;
+    ths->push_waiters = 0;
+    ths->closed = false;
+
+    pthread_mutex_init(&ths->mutex, NULL);
+
+#ifdef __UNDS_USE_MONOTONIC_COND
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&ths->not_empty, &attr);
+    pthread_cond_init(&ths->not_full, &attr);
+    pthread_condattr_destroy(&attr);
+#else
+    pthread_cond_init(&ths->not_empty, NULL);
+    pthread_cond_init(&ths->not_full, NULL);
+#endif
 
-    for (size_t i = 0; i < size; i++)
-        memcpy((char*)ths->arr + i * of_size, value, of_size);
-    __unds_heap_queue_capacity_correction(ths);
-    
     return ths;
 }
 
-void unds_heap_queue_delete(unds_heap_queue_t* ths)
+void unds_blocking_queue_delete(unds_blocking_queue_t* ths)
 {
-    unds_free(ths->arr);
+    pthread_cond_destroy(&ths->not_full);
+    pthread_cond_destroy(&ths->not_empty);
+    pthread_mutex_destroy(&ths->mutex);
+    unds_queue_delete(ths->queue);
     unds_free(ths);
 }
 
-bool unds_heap_queue_empty(unds_heap_queue_t* ths)
+bool unds_blocking_queue_empty(unds_blocking_queue_t* ths)
 {
-    return ths->size == 0;
+    return unds_blocking_queue_size(ths) == 0;
 }
 
-void unds_heap_queue_push(unds_heap_queue_t* ths, void* value)
+size_t unds_blocking_queue_size(unds_blocking_queue_t* ths)
 {
-    if (ths->size == ths->capacity)
-        __unds_heap_queue_double(ths);
-
-    memcpy((char*)ths->arr + ths->size * ths->of_size, value, ths->of_size);
-    __unds_heap_queue_reheap_up(ths, ths->size);
+    pthread_mutex_lock(&ths->mutex);
+    size_t size = ths->queue->size;
+    pthread_mutex_unlock(&ths->mutex);
 
-    ths->size++;
+    return size;
 }
 
-void unds_heap_queue_pop(unds_heap_queue_t* ths)
+bool unds_blocking_queue_push(unds_blocking_queue_t* ths, void* value)
 {
-    if (unds_heap_queue_empty(ths))
+    pthread_mutex_lock(&ths->mutex);
+
+    while (ths->queue->size == ths->capacity && !ths->closed)
     {
-        fprintf(stderr, "stderr: Failed to pop an element from heap queue because the heap queue is empty.\n");
-        abort();
+        ths->push_waiters++;
+        pthread_cond_wait(&ths->not_full, &ths->mutex);
+        ths->push_waiters--;
     }
 
-    ths->size--;
+    if (ths->closed)
+    {
+        pthread_mutex_unlock(&ths->mutex);
+        return false;
+    }
 
-    memcpy(ths->arr, (char*)ths->arr + ths->size * ths->of_size, ths->of_size);
-    __unds_heap_queue_reheap_down(ths, 0);
+    unds_queue_push(ths->queue, value);
+    if (ths->pop_waiters > 0)
+        pthread_cond_signal(&ths->not_empty);
 
-    if (ths->size == ths->capacity / 2)
-        __unds_heap_queue_half(ths);
+    pthread_mutex_unlock(&ths->mutex);
+
+    return true;
 }
 
-void unds_heap_queue_front(unds_heap_queue_t* ths, void* dest)
+bool unds_blocking_queue_try_push(unds_blocking_queue_t* ths, void* value)
 {
-    if (unds_heap_queue_empty(ths))
+    pthread_mutex_lock(&ths->mutex);
+
+    if (ths->queue->size == ths->capacity || ths->closed)
     {
-        fprintf(stderr, "stderr: Failed to read from the front of the heap queue because the heap queue is empty.\n");
-        abort();
+        pthread_mutex_unlock(&ths->mutex);
+        return false;
     }
 
-    memcpy(dest, ths->arr, ths->of_size);
+    unds_queue_push(ths->queue, value);
+    if (ths->pop_waiters > 0)
+        pthread_cond_signal(&ths->not_empty);
+
+    pthread_mutex_unlock(&ths->mutex);
+
+    return true;
 }
 
-void unds_heap_queue_clear(unds_heap_queue_t* ths)
+bool unds_blocking_queue_pop(unds_blocking_queue_t* ths, void* dest)
 {
-    ths->arr = unds_realloc(ths->arr, ths->of_size);
-    if (ths->arr == NULL)
+    pthread_mutex_lock(&ths->mutex);
+
+    while (ths->queue->size == 0 && !ths->closed)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for stack in heap_queue_clear().\n");
-        abort();
+        ths->pop_waiters++;
+        pthread_cond_wait(&ths->not_empty, &ths->mutex);
+        ths->pop_waiters--;
     }
 
-    ths->capacity = 1;
-    ths->size = 0;
+    if (ths->queue->size == 0)
+    {
+        pthread_mutex_unlock(&ths->mutex);
+        return false;
+    }
+
+    __unds_blocking_queue_take(ths, dest);
+    pthread_mutex_unlock(&ths->mutex);
+
+    return true;
 }
 
-/**
- * *내부 함수
- * 
- * @brief 큐 크기 2배 증가
- * @param ths 대상 큐 포인터
- */
-void __unds_queue_double(unds_queue_t* ths)
+bool unds_blocking_queue_try_pop(unds_blocking_queue_t* ths, void* dest)
 {
-    ths->capacity *= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
-    if (ths->arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to reallocate memory for queue in __queue_double().\n");
-        abort();
-    }
+    pthread_mutex_lock(&ths->mutex);
 
-    if (ths->head > ths->tail)
+    if (ths->queue->size == 0)
     {
-        size_t head_to_end = ths->capacity / 2 - ths->head;
+        pthread_mutex_unlock(&ths->mutex);
+        return false;
+    }
 
-        memmove((char*)ths->arr + (ths->capacity - head_to_end) * ths->of_size, (char*)ths->arr + ths->head * ths->of_size, head_to_end * ths->of_size);
+    __unds_blocking_queue_take(ths, dest);
+    pthread_mutex_unlock(&ths->mutex);
 
-        ths->head = ths->capacity - head_to_end;
-    }
+    return true;
 }
 
-/**
- * *내부 함수
- * 
- * @brief 큐 크기 2배 감소
- * @param ths 대상 큐 포인터
- */
-void __unds_queue_half(unds_queue_t* ths)
+bool unds_blocking_queue_pop_timeout(unds_blocking_queue_t* ths, void* dest, size_t timeout_ms)
 {
-    if (ths->size == 0)
-        return;
+    struct timespec deadline;
+    __unds_blocking_queue_deadline(&deadline, timeout_ms);
 
-    if (ths->head < ths->tail)
-        memmove(ths->arr, (char*)ths->arr + ths->head * ths->of_size, ths->size * ths->of_size);
-    else
+    pthread_mutex_lock(&ths->mutex);
+
+    // 깨어났지만 다른 스레드가 먼저 가져간 경우에도 남은 시간만큼만 다시 기다린다.
+    while (ths->queue->size == 0 && !ths->closed)
     {
-        size_t head_to_end = ths->capacity - ths->head;
-        size_t begin_to_tail = ths->tail;
+        ths->pop_waiters++;
+        int result = pthread_cond_timedwait(&ths->not_empty, &ths->mutex, &deadline);
+        ths->pop_waiters--;
 
-        memmove((char*)ths->arr + head_to_end * ths->of_size, ths->arr, begin_to_tail * ths->of_size);
-        memmove(ths->arr, (char*)ths->arr + ths->head * ths->of_size, head_to_end * ths->of_size);
+        if (result != 0)
+            break;
     }
 
-    ths->capacity /= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
-    if (ths->arr == NULL)
+    if (ths->queue->size == 0)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for queue in __queue_half().\n");
-        abort();
+        pthread_mutex_unlock(&ths->mutex);
+        return false;
     }
 
-    ths->head = 0;
-    ths->tail = ths->capacity - 1;
+    __unds_blocking_queue_take(ths, dest);
+    pthread_mutex_unlock(&ths->mutex);
+
+    return true;
 }
 
-/**
- * *내부 함수
- *
- * @brief 큐의 크기를 2의 제곱수로 교정
- * @param ths 대상 큐 포인터
- */
-void __unds_queue_capacity_correction(unds_queue_t* ths)
+size_t unds_blocking_queue_drain(unds_blocking_queue_t* ths, void* dest, size_t max)
 {
-    size_t correct_capacity = 1;
-
-    while (correct_capacity <= ths->size + 1)
-        correct_capacity *= 2;
+    pthread_mutex_lock(&ths->mutex);
 
-    ths->arr = unds_realloc(ths->arr, correct_capacity * ths->of_size);
-    if (ths->arr == NULL)
+    size_t n = ths->queue->size < max ? ths->queue->size : max;
+    if (n > 0)
     {
-        fprintf(stderr, "stderr: Failed to reallocate memory for queue in __queue_capacity_correction().\n");
-        abort();
+        unds_queue_pop_n(ths->queue, dest, n);
+
+        // 여러 자리가 한꺼번에 비었으므로 기다리는 생산자를 모두 깨운다.
+        if (ths->push_waiters > 0)
+            pthread_cond_broadcast(&ths->not_full);
     }
 
-    ths->capacity = correct_capacity;
+    pthread_mutex_unlock(&ths->mutex);
+
+    return n;
 }
 
-unds_queue_t* unds_queue_create(size_t of_size)
+void unds_blocking_queue_close(unds_blocking_queue_t* ths)
 {
-    unds_queue_t* ths = (unds_queue_t*)unds_malloc(sizeof(unds_queue_t));
+    pthread_mutex_lock(&ths->mutex);
+    ths->closed = true;
+    pthread_cond_broadcast(&ths->not_empty);
+    pthread_cond_broadcast(&ths->not_full);
+    pthread_mutex_unlock(&ths->mutex);
+}
 
-    ths->arr = unds_malloc(of_size);
-    if (ths->arr == NULL)
+bool unds_blocking_queue_closed(unds_blocking_queue_t* ths)
+{
+    pthread_mutex_lock(&ths->mutex);
+    bool closed = ths->closed;
+    pthread_mutex_unlock(&ths->mutex);
+
+    return closed;
+}
+
+unds_locked_heap_queue_t* unds_locked_heap_queue_create(size_t of_size, int (*comp)(const void* p, const void* q))
+{
+    unds_locked_heap_queue_t* ths = (unds_locked_heap_queue_t*)unds_malloc(sizeof(unds_locked_heap_queue_t));
+    if (ths == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for queue in queue_create().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for heap queue in unds_locked_heap_queue_create().\n");
         abort();
     }
 
-    ths->capacity = 1;
-    ths->size = 0;
-    ths->of_size = of_size;
-    ths->head = 0;
-    ths->tail = 0;
+    ths->heap = unds_heap_queue_create(of_size, comp);
+    pthread_mutex_init(&ths->mutex, NULL);
 
     return ths;
 }
 
-unds_queue_t* unds_queue_create_from_array(void* arr, size_t size, size_t of_size)
+void unds_locked_heap_queue_delete(unds_locked_heap_queue_t* ths)
 {
-    if (arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to initialize queue since the original array is NULL.\n");
-        abort();
-    }
-    else if (of_size == 0)
-    {
-        fprintf(stderr, "stderr: Size of a single element of queue cannot be zero.");
-        abort();
-    }
+    pthread_mutex_destroy(&ths->mutex);
+    unds_heap_queue_delete(ths->heap);
+    unds_free(ths);
+}
 
-    unds_queue_t* ths = (unds_queue_t*)unds_malloc(sizeof(unds_queue_t));
+size_t unds_locked_heap_queue_size(unds_locked_heap_queue_t* ths)
+{
+    pthread_mutex_lock(&ths->mutex);
+    size_t size = ths->heap->size;
+    pthread_mutex_unlock(&ths->mutex);
 
-    ths->arr = unds_malloc(size * of_size);
-    if (ths->arr == NULL)
+    return size;
+}
+
+bool unds_locked_heap_queue_empty(unds_locked_heap_queue_t* ths)
+{
+    return unds_locked_heap_queue_size(ths) == 0;
+}
+
+void unds_locked_heap_queue_push(unds_locked_heap_queue_t* ths, void* value)
+{
+    pthread_mutex_lock(&ths->mutex);
+    unds_heap_queue_push(ths->heap, value);
+    pthread_mutex_unlock(&ths->mutex);
+}
+
+bool unds_locked_heap_queue_try_pop(unds_locked_heap_queue_t* ths, void* dest)
+{
+    pthread_mutex_lock(&ths->mutex);
+
+    if (unds_heap_queue_empty(ths->heap))
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for queue in queue_create_from_array().\n");
-        abort();
+        pthread_mutex_unlock(&ths->mutex);
+        return false;
     }
 
-    ths->capacity = size;
-    ths->size = size;
-    ths->of_size = of_size;
-    ths->head = 0;
-    ths->tail = size;
+    if (dest != NULL)
+        unds_heap_queue_front(ths->heap, dest);
+    unds_heap_queue_pop(ths->heap);
 
-    memcpy(ths->arr, arr, size * of_size);
-    __unds_queue_capacity_correction(ths);
+    pthread_mutex_unlock(&ths->mutex);
 
-    return ths;
+    return true;
 }
 
-unds_queue_t* unds_queue_create_from_value(void* value, size_t size, size_t of_size)
+/**
+ * *내부 변수
+ *
+ * 멀티큐가 힙큐를 고를 때 사용하는 스레드별 난수 상태 (0이면 아직 초기화되지 않음)
+ */
+_Thread_local uint32_t __unds_multi_queue_seed = 0;
+
+/**
+ * *내부 함수
+ *
+ * @brief 0 이상 bound 미만의 난수 반환 (xorshift32)
+ * @param bound 난수의 상한
+ * @return 난수
+ */
+size_t __unds_multi_queue_random(size_t bound)
 {
-    if (value == NULL)
+    uint32_t x = __unds_multi_queue_seed;
+
+    // 스레드마다 다른 지역 변수의 주소로 초기값을 정한다.
+    if (x == 0)
+        x = (uint32_t)((uintptr_t)&x >> 4) * 2654435761u | 1;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    __unds_multi_queue_seed = x;
+
+    return (size_t)x % bound;
+}
+
+/**
+ * *내부 함수
+ *
+ * 잠금을 잡은 상태에서 호출해야 한다.
+ *
+ * @brief 멀티큐의 힙큐 하나에서 앞 요소를 꺼냄
+ * @param lane 대상 힙큐
+ * @param dest 요소를 복사할 목적지 (NULL이면 삭제만 한다.)
+ */
+void __unds_multi_queue_take(struct __unds_multi_queue_lane_t* lane, void* dest)
+{
+    if (dest != NULL)
+        unds_heap_queue_front(lane->heap, dest);
+    unds_heap_queue_pop(lane->heap);
+    atomic_store_explicit(&lane->size, lane->heap->size, memory_order_relaxed);
+}
+
+unds_multi_queue_t* unds_multi_queue_create(size_t of_size, int (*comp)(const void* p, const void* q), size_t num_lanes)
+{
+    if (num_lanes == 0)
     {
-        fprintf(stderr, "stderr: Failed to initialize queue since the original array is NULL.\n");
-        abort();
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        num_lanes = online > 0 ? (size_t)online * 2 : 2;
     }
-    else if (of_size == 0)
+    if (num_lanes < 2)
+        num_lanes = 2;
+
+    unds_multi_queue_t* ths = (unds_multi_queue_t*)unds_malloc(sizeof(unds_multi_queue_t));
+    if (ths == NULL)
     {
-        fprintf(stderr, "stderr: Size of a single element of queue cannot be zero.");
+        fprintf(stderr, "stderr: Failed to allocate memory for multi queue in unds_multi_queue_create().\n");
         abort();
     }
 
-    unds_queue_t* ths = (unds_queue_t*)unds_malloc(sizeof(unds_queue_t));
-    ths->arr = unds_malloc(size * of_size);
-    if (ths->arr == NULL)
+    ths->lanes = (struct __unds_multi_queue_lane_t*)__unds_cache_aligned_alloc(num_lanes *
+                                                                              sizeof(struct __unds_multi_queue_lane_t));
+    if (ths->lanes == NULL)
     {
-        fprintf(stderr, "stderr: Failed to allocate memory for queue in queue_create_from_array().\n");
+        fprintf(stderr, "stderr: Failed to allocate memory for multi queue in unds_multi_queue_create().\n");
         abort();
     }
 
-    ths->capacity = size;
-    ths->size = size;
+    ths->num_lanes = num_lanes;
     ths->of_size = of_size;
-    ths->head = 0;
-    ths->tail = size;
+    ths->comp = comp;
+
+    for (size_t i = 0; i < num_lanes; i++)
+    {
+        pthread_mutex_init(&ths->lanes[i].mutex, NULL);
+        ths->lanes[i].heap = unds_heap_queue_create(of_size, comp);
+        atomic_init(&ths->lanes[i].size, 0);
+    }
 
-    for (size_t i = 0; i < size; i++)
-        memcpy((char*)ths->arr + i * of_size, value, of_size);
-    __unds_queue_capacity_correction(ths);
-    
     return ths;
 }
 
-void unds_queue_delete(unds_queue_t* ths)
+void unds_multi_queue_delete(unds_multi_queue_t* ths)
 {
-    unds_free(ths->arr);
+    for (size_t i = 0; i < ths->num_lanes; i++)
+    {
+        pthread_mutex_destroy(&ths->lanes[i].mutex);
+        unds_heap_queue_delete(ths->lanes[i].heap);
+    }
+
+    __unds_cache_aligned_free(ths->lanes);
     unds_free(ths);
 }
 
-bool unds_queue_empty(unds_queue_t* ths)
+size_t unds_multi_queue_size(unds_multi_queue_t* ths)
 {
-    return ths->size == 0;
+    size_t size = 0;
+
+    for (size_t i = 0; i < ths->num_lanes; i++)
+        size += atomic_load_explicit(&ths->lanes[i].size, memory_order_relaxed);
+
+    return size;
 }
 
-void unds_queue_push(unds_queue_t* ths, void* value)
+bool unds_multi_queue_empty(unds_multi_queue_t* ths)
 {
-    if (ths->size + 1 == ths->capacity)
-        __unds_queue_double(ths);
+    return unds_multi_queue_size(ths) == 0;
+}
 
-    memcpy((char*)ths->arr + ths->tail * ths->of_size, value, ths->of_size);
+void unds_multi_queue_push(unds_multi_queue_t* ths, void* value)
+{
+    struct __unds_multi_queue_lane_t* lane = &ths->lanes[__unds_multi_queue_random(ths->num_lanes)];
 
-    ths->tail++;
-    ths->tail %= ths->capacity;
+    // 다른 스레드가 잡고 있는 힙큐는 기다리지 않고 다른 힙큐를 고른다.
+    while (pthread_mutex_trylock(&lane->mutex) != 0)
+        lane = &ths->lanes[__unds_multi_queue_random(ths->num_lanes)];
 
-    ths->size++;
+    unds_heap_queue_push(lane->heap, value);
+    atomic_store_explicit(&lane->size, lane->heap->size, memory_order_relaxed);
+
+    pthread_mutex_unlock(&lane->mutex);
 }
 
-void unds_queue_pop(unds_queue_t* ths)
+bool unds_multi_queue_try_pop(unds_multi_queue_t* ths, void* dest)
 {
-    if (unds_queue_empty(ths))
+    for (;;)
     {
-        fprintf(stderr, "stderr: Failed to pop an element from queue because the queue is empty.\n");
-        abort();
-    }
+        size_t i = __unds_multi_queue_random(ths->num_lanes);
+        size_t j = __unds_multi_queue_random(ths->num_lanes - 1);
+        if (j >= i)
+            j++;
 
-    ths->head++;
-    ths->head %= ths->capacity;
+        struct __unds_multi_queue_lane_t* a = &ths->lanes[i];
+        struct __unds_multi_queue_lane_t* b = &ths->lanes[j];
 
-    ths->size--;
+        // 두 힙큐가 모두 비어 보이면 전체가 비었는지 확인한다.
+        if (atomic_load_explicit(&a->size, memory_order_relaxed) == 0 &&
+            atomic_load_explicit(&b->size, memory_order_relaxed) == 0)
+        {
+            if (unds_multi_queue_empty(ths))
+                return false;
+            continue;
+        }
 
-    if (ths->size + 1 == ths->capacity / 2)
-        __unds_queue_half(ths);
-}
+        if (pthread_mutex_trylock(&a->mutex) != 0)
+            continue;
+        if (pthread_mutex_trylock(&b->mutex) != 0)
+        {
+            pthread_mutex_unlock(&a->mutex);
+            continue;
+        }
 
-void unds_queue_front(unds_queue_t* ths, void* dest)
-{
-    if (unds_queue_empty(ths))
-    {
-        fprintf(stderr, "stderr: Failed to read from the front of the queue because the queue is empty.\n");
-        abort();
-    }
+        struct __unds_multi_queue_lane_t* best = NULL;
+        if (a->heap->size > 0 && b->heap->size > 0)
+            best = ths->comp(a->heap->arr, b->heap->arr) < 0 ? a : b;
+        else if (a->heap->size > 0)
+            best = a;
+        else if (b->heap->size > 0)
+            best = b;
 
-    memcpy(dest, (char*)ths->arr + ths->head * ths->of_size, ths->of_size);
-}
+        if (best != NULL)
+            __unds_multi_queue_take(best, dest);
+
+        pthread_mutex_unlock(&b->mutex);
+        pthread_mutex_unlock(&a->mutex);
 
-void unds_queue_back(unds_queue_t* ths, void* dest)
-{
-    if (unds_queue_empty(ths))
-    {
-        fprintf(stderr, "stderr: Failed to read from the back of the queue because the queue is empty.\n");
-        abort();
+        if (best != NULL)
+            return true;
     }
-
-    memcpy(dest, (char*)ths->arr + (ths->tail + ths->capacity - 1) % ths->capacity * ths->of_size, ths->of_size);
 }
 
-void unds_queue_clear(unds_queue_t* ths)
-{
-    ths->arr = unds_realloc(ths->arr, ths->of_size);
-    if (ths->arr == NULL)
-    {
-        fprintf(stderr, "stderr: Failed to reallocate memory for stack in queue_clear().\n");
-        abort();
-    }
 
-    ths->capacity = 1;
-    ths->size = 0;
-    ths->head = 0;
-    ths->tail = 0;
-}
+#endif
 
 /**
  * *내부 함수
@@ -2331,7 +10711,7 @@ void unds_queue_clear(unds_queue_t* ths)
 void __unds_stack_double(unds_stack_t* ths)
 {
     ths->capacity *= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity / 2, ths->capacity, ths->of_size);
     if (ths->arr == NULL)
     {
         fprintf(stderr, "stderr: Failed to reallocate memory for stack in __stack_double().\n");
@@ -2347,11 +10727,11 @@ void __unds_stack_double(unds_stack_t* ths)
  */
 void __unds_stack_half(unds_stack_t* ths)
 {
-    if (ths->size == 0)
+    if (ths->size == 0 || ths->capacity / 2 < ths->inline_capacity)
         return;
 
     ths->capacity /= 2;
-    ths->arr = unds_realloc(ths->arr, ths->capacity * ths->of_size);
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity * 2, ths->capacity, ths->of_size);
     if (ths->arr == NULL)
     {
         fprintf(stderr, "stderr: Failed to reallocate memory for stack in __stack_half().\n");
@@ -2371,8 +10751,10 @@ void __unds_stack_capacity_correction(unds_stack_t* ths)
 
     while (correct_capacity <= ths->size)
         correct_capacity *= 2;
+    if (correct_capacity < ths->inline_capacity)
+        correct_capacity = ths->inline_capacity;
 
-    ths->arr = unds_realloc(ths->arr, correct_capacity * ths->of_size);
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity, correct_capacity, ths->of_size);
     if (ths->arr == NULL)
     {
         fprintf(stderr, "stderr: Failed to reallocate memory for stack in __stack_capacity_correction().\n");
@@ -2386,7 +10768,7 @@ unds_stack_t* unds_stack_create(size_t of_size)
 {
     unds_stack_t* ths = (unds_stack_t*)unds_malloc(sizeof(unds_stack_t));
 
-    ths->arr = unds_malloc(of_size);
+    ths->arr = __unds_storage_alloc(of_size);
     if (ths->arr == NULL)
     {
         fprintf(stderr, "stderr: Failed to allocate memory for stack in stack_create().\n");
@@ -2395,6 +10777,8 @@ unds_stack_t* unds_stack_create(size_t of_size)
 
     ths->capacity = 1;
     ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
     ths->size = 0;
 
     return ths;
@@ -2415,7 +10799,7 @@ unds_stack_t* unds_stack_create_from_array(void* arr, size_t size, size_t of_siz
 
     unds_stack_t* ths = (unds_stack_t*)unds_malloc(sizeof(unds_stack_t));
 
-    ths->arr = unds_malloc(size * of_size);
+    ths->arr = __unds_storage_alloc(size * of_size);
     if (ths->arr == NULL)
     {
         fprintf(stderr, "stderr: Failed to allocate memory for stack in stack_create_from_array().\n");
@@ -2425,6 +10809,8 @@ unds_stack_t* unds_stack_create_from_array(void* arr, size_t size, size_t of_siz
     ths->capacity = size;
     ths->size = size;
     ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
 
     memcpy(ths->arr, arr, size * of_size);
     __unds_stack_capacity_correction(ths);
@@ -2446,7 +10832,7 @@ unds_stack_t* unds_stack_create_from_value(void* value, size_t size, size_t of_s
     }
 
     unds_stack_t* ths = (unds_stack_t*)unds_malloc(sizeof(unds_stack_t));
-    ths->arr = unds_malloc(size * of_size);
+    ths->arr = __unds_storage_alloc(size * of_size);
     if (ths->arr == NULL)
     {
         fprintf(stderr, "stderr: Failed to allocate memory for stack in stack_create_from_array().\n");
@@ -2456,6 +10842,8 @@ unds_stack_t* unds_stack_create_from_value(void* value, size_t size, size_t of_s
     ths->capacity = size;
     ths->size = size;
     ths->of_size = of_size;
+    ths->inline_arr = NULL;
+    ths->inline_capacity = 0;
 
     for (size_t i = 0; i < size; i++)
         memcpy((char*)ths->arr + i * of_size, value, of_size);
@@ -2464,9 +10852,76 @@ unds_stack_t* unds_stack_create_from_value(void* value, size_t size, size_t of_s
     return ths;
 }
 
+unds_stack_t* unds_stack_create_inline(size_t of_size, size_t capacity)
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of stack cannot be zero.\n");
+        abort();
+    }
+
+    capacity = __unds_inline_capacity(capacity);
+
+    unds_stack_t* ths = (unds_stack_t*)unds_malloc(__UNDS_INLINE_OFFSET(unds_stack_t) + capacity * of_size);
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for stack in unds_stack_create_inline().\n");
+        abort();
+    }
+
+    unds_stack_init(ths, of_size, capacity > 0 ? (char*)ths + __UNDS_INLINE_OFFSET(unds_stack_t) : NULL, capacity);
+
+    return ths;
+}
+
+void unds_stack_init(unds_stack_t* ths, size_t of_size, void* storage, size_t capacity)
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of stack cannot be zero.\n");
+        abort();
+    }
+
+    capacity = storage != NULL ? __unds_inline_capacity(capacity) : 0;
+
+    if (capacity == 0)
+    {
+        ths->arr = __unds_storage_alloc(of_size);
+        if (ths->arr == NULL)
+        {
+            fprintf(stderr, "stderr: Failed to allocate memory for stack in unds_stack_init().\n");
+            abort();
+        }
+
+        ths->capacity = 1;
+        ths->inline_arr = NULL;
+    }
+    else
+    {
+        ths->arr = storage;
+        ths->capacity = capacity;
+        ths->inline_arr = storage;
+    }
+
+    ths->inline_capacity = capacity;
+    ths->size = 0;
+    ths->of_size = of_size;
+}
+
+void unds_stack_deinit(unds_stack_t* ths)
+{
+    if (ths->arr != ths->inline_arr)
+        __unds_storage_free(ths->arr);
+
+    ths->arr = NULL;
+    ths->capacity = 0;
+    ths->size = 0;
+}
+
 void unds_stack_delete(unds_stack_t* ths)
 {
-    unds_free(ths->arr);
+    if (ths->arr != ths->inline_arr)
+        __unds_storage_free(ths->arr);
     unds_free(ths);
 }
 
@@ -2510,17 +10965,469 @@ void unds_stack_top(unds_stack_t* ths, void* dest)
 
 void unds_stack_clear(unds_stack_t* ths)
 {
-    ths->arr = unds_realloc(ths->arr, ths->of_size);
+    size_t capacity = ths->inline_capacity > 0 ? ths->inline_capacity : 1;
+
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity, capacity, ths->of_size);
     if (ths->arr == NULL)
     {
         fprintf(stderr, "stderr: Failed to reallocate memory for stack in stack_clear().\n");
         abort();
     }
 
-    ths->capacity = 1;
+    ths->capacity = capacity;
     ths->size = 0;
 }
 
+void unds_stack_reserve(unds_stack_t* ths, size_t capacity)
+{
+    if (capacity <= ths->capacity)
+        return;
+
+    size_t correct_capacity = __unds_grow_capacity(ths->capacity, capacity, ths->of_size, "unds_stack_reserve");
+
+    ths->arr = __unds_inline_realloc(ths->arr, ths->inline_arr, ths->inline_capacity, ths->capacity, correct_capacity, ths->of_size);
+    if (ths->arr == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for stack in unds_stack_reserve().\n");
+        abort();
+    }
+
+    ths->capacity = correct_capacity;
+}
+
+void unds_stack_shrink_to_fit(unds_stack_t* ths)
+{
+    __unds_stack_capacity_correction(ths);
+}
+
+void unds_stack_push_n(unds_stack_t* ths, void* arr, size_t n)
+{
+    unds_stack_reserve(ths, ths->size + n);
+
+    memcpy((char*)ths->arr + ths->size * ths->of_size, arr, n * ths->of_size);
+    ths->size += n;
+}
+
+void unds_stack_pop_n(unds_stack_t* ths, void* dest, size_t n)
+{
+    if (n > ths->size)
+    {
+        fprintf(stderr, "stderr: Failed to pop %zu elements from stack because the stack has only %zu.\n", n, ths->size);
+        abort();
+    }
+
+    ths->size -= n;
+
+    if (dest != NULL)
+        memcpy(dest, (char*)ths->arr + ths->size * ths->of_size, n * ths->of_size);
+
+    if (ths->size > 0 && ths->size <= ths->capacity / 4)
+        __unds_stack_capacity_correction(ths);
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 노드를 만료 틱에 맞는 칸에 연결
+ * @param ths 대상 타이머 휠 포인터
+ * @param index 연결할 노드의 인덱스
+ */
+void __unds_timer_wheel_link(unds_timer_wheel_t* ths, size_t index)
+{
+    struct __unds_timer_node_t* node = &ths->nodes[index];
+    uint64_t expires = node->expires;
+    size_t level = 0;
+    size_t slot;
+
+    // 이미 처리한 틱의 타이머는 다음 unds_timer_wheel_advance에서 바로 만료되도록 따로 모은다.
+    if (expires < ths->current)
+    {
+        level = UNDS_TIMER_WHEEL_LEVELS;
+        slot = __UNDS_TIMER_WHEEL_OVERDUE;
+    }
+    else
+    {
+        uint64_t delta = expires - ths->current;
+
+        while (level + 1 < UNDS_TIMER_WHEEL_LEVELS && delta >> (UNDS_TIMER_WHEEL_BITS * (level + 1)) != 0)
+            level++;
+
+        // 마지막 단계보다 먼 타이머는 마지막 단계의 가장 먼 칸에 두었다가 다시 연결한다.
+        if (level == UNDS_TIMER_WHEEL_LEVELS - 1 && delta >> (UNDS_TIMER_WHEEL_BITS * UNDS_TIMER_WHEEL_LEVELS) != 0)
+            expires = ths->current + (((uint64_t)1 << (UNDS_TIMER_WHEEL_BITS * UNDS_TIMER_WHEEL_LEVELS)) - 1);
+
+        slot = level * __UNDS_TIMER_WHEEL_SLOTS +
+               (size_t)((expires >> (UNDS_TIMER_WHEEL_BITS * level)) & (__UNDS_TIMER_WHEEL_SLOTS - 1));
+    }
+
+    node->slot = slot;
+    node->prev = __UNDS_TIMER_WHEEL_NIL;
+    node->next = ths->slots[slot];
+    if (node->next != __UNDS_TIMER_WHEEL_NIL)
+        ths->nodes[node->next].prev = index;
+    ths->slots[slot] = index;
+    ths->level_size[level]++;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 노드를 칸에서 떼어냄
+ * @param ths 대상 타이머 휠 포인터
+ * @param index 떼어낼 노드의 인덱스
+ */
+void __unds_timer_wheel_unlink(unds_timer_wheel_t* ths, size_t index)
+{
+    struct __unds_timer_node_t* node = &ths->nodes[index];
+
+    if (node->prev != __UNDS_TIMER_WHEEL_NIL)
+        ths->nodes[node->prev].next = node->next;
+    else
+        ths->slots[node->slot] = node->next;
+
+    if (node->next != __UNDS_TIMER_WHEEL_NIL)
+        ths->nodes[node->next].prev = node->prev;
+
+    ths->level_size[node->slot / __UNDS_TIMER_WHEEL_SLOTS]--;
+}
+
+/**
+ * *내부 함수
+ *
+ * 세대를 늘려 이 노드를 가리키던 식별자를 무효로 만든다.
+ *
+ * @brief 노드를 노드 풀에 반환
+ * @param ths 대상 타이머 휠 포인터
+ * @param index 반환할 노드의 인덱스
+ */
+void __unds_timer_wheel_release(unds_timer_wheel_t* ths, size_t index)
+{
+    struct __unds_timer_node_t* node = &ths->nodes[index];
+
+    node->generation++;
+    if (node->generation == 0)
+        node->generation = 1;
+
+    node->slot = __UNDS_TIMER_WHEEL_NIL;
+    node->next = ths->free_head;
+    ths->free_head = index;
+    ths->size--;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 노드 풀의 용량을 두 배로 늘림
+ * @param ths 대상 타이머 휠 포인터
+ */
+void __unds_timer_wheel_grow(unds_timer_wheel_t* ths)
+{
+    size_t capacity = ths->capacity == 0 ? 16 : ths->capacity * 2;
+
+    if (capacity > (size_t)UINT32_MAX + 1)
+    {
+        fprintf(stderr, "stderr: Timer wheel cannot hold more than 2^32 timers.\n");
+        abort();
+    }
+
+    struct __unds_timer_node_t* nodes =
+        (struct __unds_timer_node_t*)unds_realloc(ths->nodes, capacity * sizeof(struct __unds_timer_node_t));
+    void* values = unds_realloc(ths->values, capacity * ths->of_size);
+    if (nodes == NULL || values == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to reallocate memory for timer wheel in __unds_timer_wheel_grow().\n");
+        abort();
+    }
+
+    ths->nodes = nodes;
+    ths->values = values;
+
+    // 인덱스가 작은 노드부터 쓰이도록 거꾸로 빈 노드 목록에 넣는다.
+    for (size_t i = capacity; i > ths->capacity; i--)
+    {
+        nodes[i - 1].generation = 1;
+        nodes[i - 1].slot = __UNDS_TIMER_WHEEL_NIL;
+        nodes[i - 1].next = ths->free_head;
+        ths->free_head = i - 1;
+    }
+
+    ths->capacity = capacity;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 칸에 들어 있는 타이머를 모두 만료시킴
+ * @param ths 대상 타이머 휠 포인터
+ * @param slot 대상 칸
+ * @param expired 만료된 타이머의 값을 추가할 리스트 (NULL이면 버린다.)
+ * @return 만료된 타이머의 개수
+ */
+size_t __unds_timer_wheel_fire(unds_timer_wheel_t* ths, size_t slot, unds_list_t* expired)
+{
+    size_t node = ths->slots[slot];
+    size_t count = 0;
+
+    ths->slots[slot] = __UNDS_TIMER_WHEEL_NIL;
+
+    while (node != __UNDS_TIMER_WHEEL_NIL)
+    {
+        size_t next = ths->nodes[node].next;
+
+        if (expired != NULL)
+            unds_list_push(expired, (char*)ths->values + node * ths->of_size);
+
+        __unds_timer_wheel_release(ths, node);
+        count++;
+        node = next;
+    }
+
+    ths->level_size[slot / __UNDS_TIMER_WHEEL_SLOTS] -= count;
+
+    return count;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 식별자가 가리키는 등록된 노드의 인덱스 반환
+ * @param ths 대상 타이머 휠 포인터
+ * @param id 타이머의 식별자
+ * @return 노드의 인덱스 (등록되어 있지 않으면 __UNDS_TIMER_WHEEL_NIL)
+ */
+size_t __unds_timer_wheel_find(unds_timer_wheel_t* ths, unds_timer_id_t id)
+{
+    size_t index = (size_t)(id & UINT32_MAX);
+
+    if (index >= ths->capacity || ths->nodes[index].slot == __UNDS_TIMER_WHEEL_NIL ||
+        ths->nodes[index].generation != (uint32_t)(id >> 32))
+        return __UNDS_TIMER_WHEEL_NIL;
+
+    return index;
+}
+
+unds_timer_wheel_t* unds_timer_wheel_create(size_t of_size, uint64_t tick, uint64_t now)
+{
+    if (of_size == 0)
+    {
+        fprintf(stderr, "stderr: Size of a single element of timer wheel cannot be zero.\n");
+        abort();
+    }
+
+    if (tick == 0)
+    {
+        fprintf(stderr, "stderr: Tick of timer wheel cannot be zero.\n");
+        abort();
+    }
+
+    unds_timer_wheel_t* ths = (unds_timer_wheel_t*)unds_malloc(sizeof(unds_timer_wheel_t));
+    if (ths == NULL)
+    {
+        fprintf(stderr, "stderr: Failed to allocate memory for timer wheel in unds_timer_wheel_create().\n");
+        abort();
+    }
+
+    ths->nodes = NULL;
+    ths->values = NULL;
+    ths->capacity = 0;
+    ths->of_size = of_size;
+    ths->tick = tick;
+    ths->current = now / tick;
+    unds_timer_wheel_clear(ths);
+
+    return ths;
+}
+
+void unds_timer_wheel_delete(unds_timer_wheel_t* ths)
+{
+    unds_free(ths->nodes);
+    unds_free(ths->values);
+    unds_free(ths);
+}
+
+bool unds_timer_wheel_empty(unds_timer_wheel_t* ths)
+{
+    return ths->size == 0;
+}
+
+size_t unds_timer_wheel_size(unds_timer_wheel_t* ths)
+{
+    return ths->size;
+}
+
+unds_timer_id_t unds_timer_wheel_schedule(unds_timer_wheel_t* ths, uint64_t deadline, void* value)
+{
+    if (ths->free_head == __UNDS_TIMER_WHEEL_NIL)
+        __unds_timer_wheel_grow(ths);
+
+    size_t index = ths->free_head;
+    struct __unds_timer_node_t* node = &ths->nodes[index];
+
+    ths->free_head = node->next;
+    ths->size++;
+
+    node->expires = deadline / ths->tick + (deadline % ths->tick != 0);
+    memcpy((char*)ths->values + index * ths->of_size, value, ths->of_size);
+    __unds_timer_wheel_link(ths, index);
+
+    return ((unds_timer_id_t)node->generation << 32) | (unds_timer_id_t)index;
+}
+
+bool unds_timer_wheel_cancel(unds_timer_wheel_t* ths, unds_timer_id_t id, void* dest)
+{
+    size_t index = __unds_timer_wheel_find(ths, id);
+    if (index == __UNDS_TIMER_WHEEL_NIL)
+        return false;
+
+    if (dest != NULL)
+        memcpy(dest, (char*)ths->values + index * ths->of_size, ths->of_size);
+
+    __unds_timer_wheel_unlink(ths, index);
+    __unds_timer_wheel_release(ths, index);
+
+    return true;
+}
+
+bool unds_timer_wheel_pending(unds_timer_wheel_t* ths, unds_timer_id_t id)
+{
+    return __unds_timer_wheel_find(ths, id) != __UNDS_TIMER_WHEEL_NIL;
+}
+
+size_t unds_timer_wheel_advance(unds_timer_wheel_t* ths, uint64_t now, unds_list_t* expired)
+{
+    if (expired != NULL && expired->of_size != ths->of_size)
+    {
+        fprintf(stderr, "stderr: Size of a single element of the list does not match the timer wheel.\n");
+        abort();
+    }
+
+    uint64_t target = now / ths->tick;
+    size_t count = __unds_timer_wheel_fire(ths, __UNDS_TIMER_WHEEL_OVERDUE, expired);
+
+    while (ths->current <= target)
+    {
+        if (ths->size == 0)
+        {
+            ths->current = target + 1;
+            break;
+        }
+
+        size_t index = (size_t)(ths->current & (__UNDS_TIMER_WHEEL_SLOTS - 1));
+
+        // 0단계가 비어 있으면 다음 0단계 한 바퀴의 시작까지 건너뛴다.
+        if (index != 0 && ths->level_size[0] == 0)
+        {
+            uint64_t next = (ths->current | (__UNDS_TIMER_WHEEL_SLOTS - 1)) + 1;
+            ths->current = next <= target ? next : target + 1;
+            continue;
+        }
+
+        // 0단계가 한 바퀴를 돌 때마다 위 단계의 칸을 하나씩 아래로 옮긴다.
+        if (index == 0)
+        {
+            for (size_t level = 1; level < UNDS_TIMER_WHEEL_LEVELS; level++)
+            {
+                size_t slot_index =
+                    (size_t)((ths->current >> (UNDS_TIMER_WHEEL_BITS * level)) & (__UNDS_TIMER_WHEEL_SLOTS - 1));
+                size_t slot = level * __UNDS_TIMER_WHEEL_SLOTS + slot_index;
+                size_t node = ths->slots[slot];
+
+                // 칸을 먼저 비워야 같은 칸으로 다시 들어가는 먼 타이머가 다음 바퀴까지 남는다.
+                ths->slots[slot] = __UNDS_TIMER_WHEEL_NIL;
+
+                while (node != __UNDS_TIMER_WHEEL_NIL)
+                {
+                    size_t next = ths->nodes[node].next;
+                    ths->level_size[level]--;
+                    __unds_timer_wheel_link(ths, node);
+                    node = next;
+                }
+
+                if (slot_index != 0)
+                    break;
+            }
+        }
+
+        count += __unds_timer_wheel_fire(ths, index, expired);
+        ths->current++;
+    }
+
+    return count;
+}
+
+void unds_timer_wheel_clear(unds_timer_wheel_t* ths)
+{
+    for (size_t i = 0; i <= __UNDS_TIMER_WHEEL_OVERDUE; i++)
+        ths->slots[i] = __UNDS_TIMER_WHEEL_NIL;
+    for (size_t i = 0; i <= UNDS_TIMER_WHEEL_LEVELS; i++)
+        ths->level_size[i] = 0;
+
+    // 식별자가 무효가 되도록 모든 노드의 세대를 늘려 빈 노드 목록에 다시 넣는다.
+    ths->free_head = __UNDS_TIMER_WHEEL_NIL;
+    ths->size = ths->capacity;
+    for (size_t i = ths->capacity; i > 0; i--)
+    {
+        if (ths->nodes[i - 1].slot != __UNDS_TIMER_WHEEL_NIL)
+            __unds_timer_wheel_release(ths, i - 1);
+        else
+        {
+            ths->nodes[i - 1].next = ths->free_head;
+            ths->free_head = i - 1;
+            ths->size--;
+        }
+    }
+}
+
+#endif
+
+/**
+ * UNDS_TRACE_MEM을 정의하면 컨테이너 생성 함수를 UNDS_TRACE_CALLER로 감싸,
+ * 생성된 컨테이너의 메모리가 unds.h 내부가 아닌 생성 함수를 호출한 위치로 기록되도록 한다.
+ * (구현부보다 뒤에 정의하므로 라이브러리 내부의 호출은 감싸지 않는다.)
+ */
+#ifdef UNDS_TRACE_MEM
+#define unds_pair_create(...) UNDS_TRACE_CALLER(unds_pair_create(__VA_ARGS__))
+#define unds_list_create(...) UNDS_TRACE_CALLER(unds_list_create(__VA_ARGS__))
+#define unds_list_create_from_array(...) UNDS_TRACE_CALLER(unds_list_create_from_array(__VA_ARGS__))
+#define unds_list_create_from_value(...) UNDS_TRACE_CALLER(unds_list_create_from_value(__VA_ARGS__))
+#define unds_list_create_inline(...) UNDS_TRACE_CALLER(unds_list_create_inline(__VA_ARGS__))
+#define unds_deque_create(...) UNDS_TRACE_CALLER(unds_deque_create(__VA_ARGS__))
+#define unds_deque_create_from_array(...) UNDS_TRACE_CALLER(unds_deque_create_from_array(__VA_ARGS__))
+#define unds_deque_create_from_value(...) UNDS_TRACE_CALLER(unds_deque_create_from_value(__VA_ARGS__))
+#define unds_segmented_deque_create(...) UNDS_TRACE_CALLER(unds_segmented_deque_create(__VA_ARGS__))
+#define unds_segmented_deque_create_from_array(...) UNDS_TRACE_CALLER(unds_segmented_deque_create_from_array(__VA_ARGS__))
+#define unds_segmented_deque_create_from_value(...) UNDS_TRACE_CALLER(unds_segmented_deque_create_from_value(__VA_ARGS__))
+#define unds_hash_map_create(...) UNDS_TRACE_CALLER(unds_hash_map_create(__VA_ARGS__))
+#define unds_hash_set_create(...) UNDS_TRACE_CALLER(unds_hash_set_create(__VA_ARGS__))
+#define unds_heap_queue_create(...) UNDS_TRACE_CALLER(unds_heap_queue_create(__VA_ARGS__))
+#define unds_heap_queue_create_from_array(...) UNDS_TRACE_CALLER(unds_heap_queue_create_from_array(__VA_ARGS__))
+#define unds_heap_queue_create_from_value(...) UNDS_TRACE_CALLER(unds_heap_queue_create_from_value(__VA_ARGS__))
+#define unds_top_k_create(...) UNDS_TRACE_CALLER(unds_top_k_create(__VA_ARGS__))
+#define unds_pairing_heap_create(...) UNDS_TRACE_CALLER(unds_pairing_heap_create(__VA_ARGS__))
+#define unds_min_max_heap_create(...) UNDS_TRACE_CALLER(unds_min_max_heap_create(__VA_ARGS__))
+#define unds_min_max_heap_create_from_array(...) UNDS_TRACE_CALLER(unds_min_max_heap_create_from_array(__VA_ARGS__))
+#define unds_queue_create(...) UNDS_TRACE_CALLER(unds_queue_create(__VA_ARGS__))
+#define unds_queue_create_from_array(...) UNDS_TRACE_CALLER(unds_queue_create_from_array(__VA_ARGS__))
+#define unds_queue_create_from_value(...) UNDS_TRACE_CALLER(unds_queue_create_from_value(__VA_ARGS__))
+#define unds_queue_create_inline(...) UNDS_TRACE_CALLER(unds_queue_create_inline(__VA_ARGS__))
+#define unds_stack_create(...) UNDS_TRACE_CALLER(unds_stack_create(__VA_ARGS__))
+#define unds_stack_create_from_array(...) UNDS_TRACE_CALLER(unds_stack_create_from_array(__VA_ARGS__))
+#define unds_stack_create_from_value(...) UNDS_TRACE_CALLER(unds_stack_create_from_value(__VA_ARGS__))
+#define unds_stack_create_inline(...) UNDS_TRACE_CALLER(unds_stack_create_inline(__VA_ARGS__))
+#define unds_timer_wheel_create(...) UNDS_TRACE_CALLER(unds_timer_wheel_create(__VA_ARGS__))
+#ifdef UNDS_USE_THREADS
+#define unds_spsc_queue_create(...) UNDS_TRACE_CALLER(unds_spsc_queue_create(__VA_ARGS__))
+#define unds_spsc_queue_create_from_array(...) UNDS_TRACE_CALLER(unds_spsc_queue_create_from_array(__VA_ARGS__))
+#define unds_spsc_queue_create_from_value(...) UNDS_TRACE_CALLER(unds_spsc_queue_create_from_value(__VA_ARGS__))
+#define unds_mpmc_queue_create(...) UNDS_TRACE_CALLER(unds_mpmc_queue_create(__VA_ARGS__))
+#define unds_mpmc_queue_create_from_array(...) UNDS_TRACE_CALLER(unds_mpmc_queue_create_from_array(__VA_ARGS__))
+#define unds_mpmc_queue_create_from_value(...) UNDS_TRACE_CALLER(unds_mpmc_queue_create_from_value(__VA_ARGS__))
+#define unds_work_stealing_deque_create(...) UNDS_TRACE_CALLER(unds_work_stealing_deque_create(__VA_ARGS__))
+#define unds_task_pool_create(...) UNDS_TRACE_CALLER(unds_task_pool_create(__VA_ARGS__))
+#define unds_blocking_queue_create(...) UNDS_TRACE_CALLER(unds_blocking_queue_create(__VA_ARGS__))
+#define unds_locked_heap_queue_create(...) UNDS_TRACE_CALLER(unds_locked_heap_queue_create(__VA_ARGS__))
+#define unds_multi_queue_create(...) UNDS_TRACE_CALLER(unds_multi_queue_create(__VA_ARGS__))
+#endif
 #endif
 
 #endif
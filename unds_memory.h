@@ -7,14 +7,192 @@
 #ifndef __UNDS_MEMORY_H
 #define __UNDS_MEMORY_H
 
+#include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+/**
+ * UNDS_USE_THREADS를 정의하면 사용량과 할당 위치 테이블을 뮤텍스로 보호하므로,
+ * 여러 스레드에서 동시에 할당하고 해제해도 집계가 맞는다.
+ */
+#ifdef UNDS_USE_THREADS
+#include <pthread.h>
+#endif
+
+/**
+ * *내부 상수
+ *
+ * 스레드마다 따로 두는 변수의 저장 지정자 (스레드를 사용하지 않으면 일반 전역 변수)
+ */
+#if !defined(UNDS_USE_THREADS)
+#define __UNDS_MEMORY_THREAD_LOCAL
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define __UNDS_MEMORY_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define __UNDS_MEMORY_THREAD_LOCAL __thread
+#else
+#define __UNDS_MEMORY_THREAD_LOCAL
+#endif
+
+/**
+ * UNDS_TRACE_MEM을 정의하면 할당 위치(파일, 줄)를 함께 기록한다.
+ * 해제되지 않은 메모리를 할당 위치별로 묶어 unds_memory_trace_report()로 출력할 수 있다.
+ *
+ * 기록 대상은 unds_memory_trace_sample_rate에 따라 표본 추출된다.
+ * (N이면 평균적으로 N번의 할당 중 한 번만 기록)
+ */
+#ifdef UNDS_TRACE_MEM
+#ifndef UNDS_TRACE_MEM_MAX_SITES
+/**
+ * 기록할 수 있는 할당 위치의 최대 개수
+ */
+#define UNDS_TRACE_MEM_MAX_SITES 1024
+#endif
+#endif
+
+/**
+ * *내부 자료형
+ *
+ * malloc과 같이 모든 기본 자료형에 맞춰 정렬하기 위한 공용체
+ * (max_align_t는 C11부터 있으므로 C99에서도 쓸 수 있도록 직접 정의한다.)
+ */
+union __unds_memory_align_t
+{
+    long double ld;
+    long long ll;
+    double d;
+    void* ptr;
+    void (*func)(void);
+};
+
+/**
+ * *내부 구조체
+ *
+ * 동적할당된 블록의 앞에 위치하는 헤더
+ */
+struct __unds_memory_header_t
+{
+    /**
+     * 블록의 크기
+     */
+    size_t size;
+#ifdef UNDS_TRACE_MEM
+    /**
+     * 할당 위치 테이블에서의 인덱스 (0이면 기록되지 않은 블록)
+     */
+    size_t site;
+    /**
+     * 기록될 때의 표본 추출 비율 (추정치를 계산할 때 블록의 크기에 곱한다.)
+     */
+    size_t weight;
+#endif
+};
+
+/**
+ * *내부 자료형
+ *
+ * 블록의 앞에서 헤더가 차지하는 공간
+ * 반환하는 포인터가 malloc과 같이 정렬되도록 헤더를 정렬 단위의 배수로 늘린다.
+ */
+union __unds_memory_header_slot_t
+{
+    struct __unds_memory_header_t header;
+    union __unds_memory_align_t align;
+};
+
 /**
  * 현재까지 동적할당된 메모리의 총량
  */
 extern size_t unds_used_malloc;
 
+/**
+ * *내부 함수
+ *
+ * unds_malloc을 거치지 않는 할당(mmap 등)을 사용량에 반영할 때 사용한다.
+ *
+ * @brief 메모리 사용량을 증감
+ * @param added 늘어난 크기
+ * @param removed 줄어든 크기
+ */
+void __unds_memory_track(size_t added, size_t removed);
+
+/**
+ * *내부 함수
+ *
+ * @brief 할당 위치를 기록하는 malloc
+ * @param size 할당 받을 메모리의 크기
+ * @param file 할당을 요청한 파일 (기록하지 않으면 NULL)
+ * @param line 할당을 요청한 줄
+ * @return 동적할당된 포인터
+ */
+void* __unds_malloc_at(size_t size, const char* file, int line);
+
+/**
+ * *내부 함수
+ *
+ * @brief 할당 위치를 기록하는 calloc
+ * @param n 할당 받을 요소의 개수
+ * @param of_size 할당 받을 단일 요소의 크기
+ * @param file 할당을 요청한 파일 (기록하지 않으면 NULL)
+ * @param line 할당을 요청한 줄
+ * @return 동적할당된 포인터
+ */
+void* __unds_calloc_at(size_t n, size_t of_size, const char* file, int line);
+
+/**
+ * *내부 함수
+ *
+ * 재할당된 블록은 처음 할당된 위치를 그대로 유지한다.
+ *
+ * @brief 할당 위치를 기록하는 realloc
+ * @param ptr 재할당 받을 포인터
+ * @param size 할당 받을 메모리의 크기
+ * @param file 재할당을 요청한 파일 (기록하지 않으면 NULL)
+ * @param line 재할당을 요청한 줄
+ * @return 동적할당된 포인터
+ */
+void* __unds_realloc_at(void* ptr, size_t size, const char* file, int line);
+
+#ifdef UNDS_TRACE_MEM
+
+#define unds_malloc(size) __unds_malloc_at((size), __FILE__, __LINE__)
+#define unds_calloc(n, of_size) __unds_calloc_at((n), (of_size), __FILE__, __LINE__)
+#define unds_realloc(ptr, size) __unds_realloc_at((ptr), (size), __FILE__, __LINE__)
+
+/**
+ * *내부 함수
+ *
+ * 중첩되어 호출되면 가장 바깥의 위치를 사용한다.
+ *
+ * @brief 이후의 할당을 주어진 호출 위치로 기록하도록 설정
+ * @param file 호출한 파일
+ * @param line 호출한 줄
+ */
+void __unds_memory_trace_enter(const char* file, int line);
+
+/**
+ * *내부 함수
+ *
+ * @brief __unds_memory_trace_enter로 설정한 호출 위치를 해제
+ * @param ptr 그대로 반환할 포인터
+ * @return ptr
+ */
+void* __unds_memory_trace_leave(void* ptr);
+
+/**
+ * 포인터를 반환하는 함수 호출 call 안에서 일어난 할당을 이 매크로를 사용한 위치로 기록한다.
+ * unds.h는 컨테이너 생성 함수를 이 매크로로 감싸므로, 누수는 라이브러리 내부가 아닌 생성한 위치로 보고된다.
+ * (재할당된 블록은 처음 할당된 위치를 유지하므로 컨테이너가 늘린 저장 공간도 같은 위치로 보고된다.)
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define UNDS_TRACE_CALLER(call) (__unds_memory_trace_enter(__FILE__, __LINE__), (__typeof__(call))__unds_memory_trace_leave((void*)(call)))
+#else
+#define UNDS_TRACE_CALLER(call) (__unds_memory_trace_enter(__FILE__, __LINE__), __unds_memory_trace_leave((void*)(call)))
+#endif
+
+#else
+
 /**
  * @brief 메모리 사용량을 추적하는 malloc
  * @param size 할당 받을 메모리의 크기
@@ -38,68 +216,451 @@ void* unds_calloc(size_t n, size_t of_size);
  */
 void* unds_realloc(void* ptr, size_t size);
 
+#endif
+
+/**
+ * @brief 메모리 사용량을 추적하는 free
+ * @param ptr 해제할 포인터
+ */
+void unds_free(void* ptr);
+
+#ifdef UNDS_TRACE_MEM
+
+/**
+ * 1이면 모든 할당을 기록한다. (기본값)
+ * 0이면 기록하지 않는다.
+ */
+extern size_t unds_memory_trace_sample_rate;
+
+/**
+ * 할당 위치 테이블이 가득 차 기록하지 못한 할당의 횟수
+ */
+extern size_t unds_memory_trace_dropped;
+
+/**
+ * 살아 있는 블록의 개수와 크기는 표본으로 기록된 블록만을 센다.
+ * 추정치는 각 블록의 크기에 그 블록이 기록될 때의 표본 추출 비율을 곱해 더한 값이므로,
+ * 도중에 unds_memory_trace_sample_rate를 바꿔도 맞게 계산된다.
+ *
+ * @brief 해제되지 않은 블록을 할당 위치별로 출력
+ * @param fp 출력할 스트림
+ */
+void unds_memory_trace_report(FILE* fp);
+
+#endif
+
 #ifdef UNDS_MEMORY_IMPLEMENTATION
 
 size_t unds_used_malloc = 0;
 
-void* unds_malloc(size_t size)
+#ifdef UNDS_USE_THREADS
+/**
+ * *내부 변수
+ *
+ * 사용량과 할당 위치 테이블을 보호하는 뮤텍스
+ */
+pthread_mutex_t __unds_memory_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * *내부 함수
+ *
+ * @brief 사용량과 할당 위치 테이블의 잠금을 획득
+ */
+void __unds_memory_lock(void)
 {
-    void* buffer = malloc(size + sizeof(size_t));
-    if (buffer == NULL)
-        return NULL;
+#ifdef UNDS_USE_THREADS
+    pthread_mutex_lock(&__unds_memory_mutex);
+#endif
+}
 
-    unds_used_malloc += size;
+/**
+ * *내부 함수
+ *
+ * @brief 사용량과 할당 위치 테이블의 잠금을 해제
+ */
+void __unds_memory_unlock(void)
+{
+#ifdef UNDS_USE_THREADS
+    pthread_mutex_unlock(&__unds_memory_mutex);
+#endif
+}
+
+void __unds_memory_track(size_t added, size_t removed)
+{
+    __unds_memory_lock();
+    unds_used_malloc += added;
+    unds_used_malloc -= removed;
+    __unds_memory_unlock();
+}
+
+#ifdef UNDS_TRACE_MEM
+
+size_t unds_memory_trace_sample_rate = 1;
+size_t unds_memory_trace_dropped = 0;
+
+/**
+ * *내부 구조체
+ *
+ * 할당 위치 테이블의 항목
+ */
+struct __unds_memory_trace_site_t
+{
+    /**
+     * 할당을 요청한 파일 (비어 있는 항목이면 NULL)
+     */
+    const char* file;
+    /**
+     * 할당을 요청한 줄
+     */
+    int line;
+    /**
+     * 해제되지 않은 블록의 개수
+     */
+    size_t live_blocks;
+    /**
+     * 해제되지 않은 블록의 크기의 합
+     */
+    size_t live_bytes;
+    /**
+     * 해제되지 않은 블록의 크기에 각 블록의 가중치를 곱한 값의 합
+     */
+    size_t estimated_bytes;
+    /**
+     * 지금까지 기록된 할당의 횟수
+     */
+    size_t total_blocks;
+};
+
+/**
+ * *내부 변수
+ *
+ * 할당 위치 테이블 (0번 항목은 사용하지 않음)
+ */
+struct __unds_memory_trace_site_t __unds_memory_trace_sites[UNDS_TRACE_MEM_MAX_SITES];
+
+/**
+ * *내부 변수
+ *
+ * 다음 표본까지 남은 할당의 횟수
+ */
+size_t __unds_memory_trace_countdown = 0;
+
+/**
+ * *내부 변수
+ *
+ * 표본 간격 계산에 사용되는 xorshift 상태
+ */
+size_t __unds_memory_trace_seed = 0x9e3779b97f4a7c15u;
 
-    size_t* size_box = (size_t*)buffer;
-    *size_box = size;
+/**
+ * *내부 변수
+ *
+ * UNDS_TRACE_CALLER로 설정된 호출 위치 (설정되지 않았으면 NULL)
+ * 호출 위치는 스레드마다 따로 설정된다.
+ */
+__UNDS_MEMORY_THREAD_LOCAL const char* __unds_memory_trace_caller_file = NULL;
 
-    return (char*)buffer + sizeof(size_t);
+/**
+ * *내부 변수
+ *
+ * UNDS_TRACE_CALLER로 설정된 호출 줄
+ */
+__UNDS_MEMORY_THREAD_LOCAL int __unds_memory_trace_caller_line = 0;
+
+/**
+ * *내부 변수
+ *
+ * UNDS_TRACE_CALLER의 중첩 깊이
+ */
+__UNDS_MEMORY_THREAD_LOCAL size_t __unds_memory_trace_caller_depth = 0;
+
+void __unds_memory_trace_enter(const char* file, int line)
+{
+    if (__unds_memory_trace_caller_depth++ > 0)
+        return;
+
+    __unds_memory_trace_caller_file = file;
+    __unds_memory_trace_caller_line = line;
 }
 
-void* unds_calloc(size_t n, size_t of_size)
+void* __unds_memory_trace_leave(void* ptr)
+{
+    if (--__unds_memory_trace_caller_depth == 0)
+        __unds_memory_trace_caller_file = NULL;
+
+    return ptr;
+}
+
+/**
+ * *내부 함수
+ *
+ * 주기적인 할당 패턴과 겹치지 않도록 표본 간격은 평균이 N인 난수로 정한다.
+ *
+ * @brief 이번 할당을 기록할지 여부와 그 가중치 반환
+ * @return 기록한다면 지금의 표본 추출 비율, 기록하지 않으면 0
+ */
+size_t __unds_memory_trace_sample(void)
+{
+    if (unds_memory_trace_sample_rate <= 1)
+        return unds_memory_trace_sample_rate;
+
+    if (__unds_memory_trace_countdown > 0)
+    {
+        __unds_memory_trace_countdown--;
+        return 0;
+    }
+
+    __unds_memory_trace_seed ^= __unds_memory_trace_seed << 13;
+    __unds_memory_trace_seed ^= __unds_memory_trace_seed >> 7;
+    __unds_memory_trace_seed ^= __unds_memory_trace_seed << 17;
+    __unds_memory_trace_countdown = __unds_memory_trace_seed % (2 * unds_memory_trace_sample_rate - 1);
+
+    return unds_memory_trace_sample_rate;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 할당 위치에 대응하는 테이블 인덱스 반환
+ * @param file 할당을 요청한 파일
+ * @param line 할당을 요청한 줄
+ * @return 테이블 인덱스 (기록할 수 없으면 0)
+ */
+size_t __unds_memory_trace_find_site(const char* file, int line)
+{
+    // __FILE__은 문자열 리터럴이므로 포인터 값으로 비교한다.
+    size_t hash = ((size_t)file >> 3) * 31 + (size_t)line;
+    size_t index = hash % (UNDS_TRACE_MEM_MAX_SITES - 1) + 1;
+
+    for (size_t i = 0; i < UNDS_TRACE_MEM_MAX_SITES - 1; i++)
+    {
+        struct __unds_memory_trace_site_t* site = &__unds_memory_trace_sites[index];
+
+        if (site->file == NULL)
+        {
+            site->file = file;
+            site->line = line;
+            return index;
+        }
+        if (site->file == file && site->line == line)
+            return index;
+
+        index = index % (UNDS_TRACE_MEM_MAX_SITES - 1) + 1;
+    }
+
+    unds_memory_trace_dropped++;
+    return 0;
+}
+
+/**
+ * *내부 함수
+ *
+ * 잠금을 잡은 상태에서 호출해야 한다.
+ *
+ * @brief 새로 할당된 블록을 할당 위치 테이블에 기록
+ * @param header 블록의 헤더
+ * @param file 할당을 요청한 파일
+ * @param line 할당을 요청한 줄
+ */
+void __unds_memory_trace_attach(struct __unds_memory_header_t* header, const char* file, int line)
+{
+    header->site = 0;
+    header->weight = 0;
+
+    if (file == NULL)
+        return;
+
+    header->weight = __unds_memory_trace_sample();
+    if (header->weight == 0)
+        return;
+
+    if (__unds_memory_trace_caller_file != NULL)
+    {
+        file = __unds_memory_trace_caller_file;
+        line = __unds_memory_trace_caller_line;
+    }
+
+    header->site = __unds_memory_trace_find_site(file, line);
+    if (header->site == 0)
+        return;
+
+    struct __unds_memory_trace_site_t* site = &__unds_memory_trace_sites[header->site];
+    site->live_blocks++;
+    site->live_bytes += header->size;
+    site->estimated_bytes += header->size * header->weight;
+    site->total_blocks++;
+}
+
+/**
+ * *내부 함수
+ *
+ * 잠금을 잡은 상태에서 호출해야 한다.
+ *
+ * @brief 해제되는 블록을 할당 위치 테이블에서 제거
+ * @param header 블록의 헤더
+ */
+void __unds_memory_trace_detach(struct __unds_memory_header_t* header)
+{
+    if (header->site == 0)
+        return;
+
+    struct __unds_memory_trace_site_t* site = &__unds_memory_trace_sites[header->site];
+    site->live_blocks--;
+    site->live_bytes -= header->size;
+    site->estimated_bytes -= header->size * header->weight;
+}
+
+/**
+ * *내부 함수
+ *
+ * @brief 할당 위치를 살아 있는 블록의 크기에 대해 내림차순으로 비교
+ */
+int __unds_memory_trace_comp(const void* p, const void* q)
 {
-    void* buffer = malloc(n * of_size + sizeof(size_t));
+    size_t i = __unds_memory_trace_sites[*(const size_t*)p].live_bytes;
+    size_t j = __unds_memory_trace_sites[*(const size_t*)q].live_bytes;
+
+    return (i < j) - (i > j);
+}
+
+void unds_memory_trace_report(FILE* fp)
+{
+    size_t order[UNDS_TRACE_MEM_MAX_SITES];
+    size_t count = 0;
+    size_t live_blocks = 0;
+    size_t live_bytes = 0;
+    size_t estimated_bytes = 0;
+
+    __unds_memory_lock();
+
+    for (size_t i = 1; i < UNDS_TRACE_MEM_MAX_SITES; i++)
+    {
+        if (__unds_memory_trace_sites[i].live_blocks == 0)
+            continue;
+
+        order[count++] = i;
+        live_blocks += __unds_memory_trace_sites[i].live_blocks;
+        live_bytes += __unds_memory_trace_sites[i].live_bytes;
+        estimated_bytes += __unds_memory_trace_sites[i].estimated_bytes;
+    }
+
+    qsort(order, count, sizeof(size_t), __unds_memory_trace_comp);
+
+    fprintf(fp, "unds: %zu live block(s), %zu byte(s) sampled (estimated %zu byte(s)).\n", live_blocks, live_bytes, estimated_bytes);
+    for (size_t i = 0; i < count; i++)
+    {
+        struct __unds_memory_trace_site_t* site = &__unds_memory_trace_sites[order[i]];
+        fprintf(fp, "    %s:%d: %zu block(s), %zu byte(s) live (estimated %zu byte(s)), %zu allocation(s) sampled.\n", site->file, site->line, site->live_blocks, site->live_bytes, site->estimated_bytes, site->total_blocks);
+    }
+    if (unds_memory_trace_dropped > 0)
+        fprintf(fp, "    (%zu allocation(s) not recorded because the site table is full.)\n", unds_memory_trace_dropped);
+
+    __unds_memory_unlock();
+}
+
+#endif
+
+void* __unds_malloc_at(size_t size, const char* file, int line)
+{
+    void* buffer = malloc(size + sizeof(union __unds_memory_header_slot_t));
     if (buffer == NULL)
         return NULL;
 
-    memset(buffer, 0, n * of_size + sizeof(size_t));
+    struct __unds_memory_header_t* header = (struct __unds_memory_header_t*)buffer;
+    header->size = size;
 
-    unds_used_malloc += n * of_size;
+    __unds_memory_lock();
+    unds_used_malloc += size;
+#ifdef UNDS_TRACE_MEM
+    __unds_memory_trace_attach(header, file, line);
+#else
+    (void)file;
+    (void)line;
+#endif
+    __unds_memory_unlock();
 
-    size_t* size_box = (size_t*)buffer;
-    *size_box = n * of_size;
+    return (char*)buffer + sizeof(union __unds_memory_header_slot_t);
+}
 
-    return (char*)buffer + sizeof(size_t);
+void* __unds_calloc_at(size_t n, size_t of_size, const char* file, int line)
+{
+    void* ptr = __unds_malloc_at(n * of_size, file, line);
+    if (ptr == NULL)
+        return NULL;
+
+    memset(ptr, 0, n * of_size);
+
+    return ptr;
 }
 
-void* unds_realloc(void* ptr, size_t size)
+void* __unds_realloc_at(void* ptr, size_t size, const char* file, int line)
 {
-    void* buffer = (char*)ptr - sizeof(size_t);
-    size_t* size_box = (size_t*)buffer;
+    if (ptr == NULL)
+        return __unds_malloc_at(size, file, line);
 
-    unds_used_malloc -= *size_box;
+    void* buffer = (char*)ptr - sizeof(union __unds_memory_header_slot_t);
+    size_t old_size = ((struct __unds_memory_header_t*)buffer)->size;
 
-    buffer = realloc(buffer, size + sizeof(size_t));
+    // 실패하면 기존 블록이 그대로 남으므로 집계는 성공한 뒤에만 바꾼다.
+    buffer = realloc(buffer, size + sizeof(union __unds_memory_header_slot_t));
     if (buffer == NULL)
         return NULL;
 
-    size_box = (size_t*)buffer;
+    struct __unds_memory_header_t* header = (struct __unds_memory_header_t*)buffer;
 
-    unds_used_malloc += size;
-    *size_box = size;
+    header->size = size;
+
+    __unds_memory_lock();
+    unds_used_malloc = unds_used_malloc - old_size + size;
+#ifdef UNDS_TRACE_MEM
+    if (header->site != 0)
+    {
+        struct __unds_memory_trace_site_t* site = &__unds_memory_trace_sites[header->site];
+        site->live_bytes = site->live_bytes - old_size + size;
+        site->estimated_bytes = site->estimated_bytes - old_size * header->weight + size * header->weight;
+    }
+#endif
+    __unds_memory_unlock();
+    (void)file;
+    (void)line;
+
+    return (char*)buffer + sizeof(union __unds_memory_header_slot_t);
+}
+
+#ifndef UNDS_TRACE_MEM
 
-    return (char*)buffer + sizeof(size_t);
+void* unds_malloc(size_t size)
+{
+    return __unds_malloc_at(size, NULL, 0);
 }
 
+void* unds_calloc(size_t n, size_t of_size)
+{
+    return __unds_calloc_at(n, of_size, NULL, 0);
+}
+
+void* unds_realloc(void* ptr, size_t size)
+{
+    return __unds_realloc_at(ptr, size, NULL, 0);
+}
+
+#endif
+
 void unds_free(void* ptr)
 {
     if (ptr == NULL)
         return;
 
-    void* buffer = (char*)ptr - sizeof(size_t);
-    size_t* size_box = (size_t*)buffer;
+    void* buffer = (char*)ptr - sizeof(union __unds_memory_header_slot_t);
+    struct __unds_memory_header_t* header = (struct __unds_memory_header_t*)buffer;
 
-    unds_used_malloc -= *size_box;
+    __unds_memory_lock();
+    unds_used_malloc -= header->size;
+#ifdef UNDS_TRACE_MEM
+    __unds_memory_trace_detach(header);
+#endif
+    __unds_memory_unlock();
 
     free(buffer);
 }